@@ -37,6 +37,13 @@ UART_IIR = 0x8
 UART_LCR = 0xc # line control register
 UART_DLL = 0x0 # Divisor Latch LSB
 UART_DLM = 0x4 # Divisor Latch MSB
+UART_IER = 0x4 # interrupt enable register
+UART_MCR = 0x10 # modem control register
+
+########### CLINT ###########
+CLINT_BASE = 0x10000000
+CLINT_MTIMECMP = 0x4000 # offset of hart 0 mtimecmp
+CLINT_MTIME = 0xbff8
 
 ########### RESET ###########
 RESET_BASE = 0x6FFF0000
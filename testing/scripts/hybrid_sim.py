@@ -0,0 +1,488 @@
+#!/usr/bin/env python
+"""Hybrid simulation: fast-forward a program in Spike, then continue it
+cycle-accurately in a Verilator simulator of the GFE SoC.
+
+The program (e.g. testing/baremetal/asm/rv64ui-p-microbench, or
+bootmem/bootmem_sim for a Linux boot) runs in Spike until it has executed a
+given number of instructions, or reaches a given PC or symbol.  Its
+architectural state is then read through Spike's interactive debugger and
+moved into the RTL:
+
+  - memory: dumped by Spike and written as the simulator's Mem.hex, which
+    the memory model loads at startup;
+  - CLINT registers (mtime, mtimecmp), then CSRs, GPRs, FPRs, PC and
+    privilege level: written through the debug module by OpenOCD, while the
+    core is halted in a one-instruction loop in the boot ROM (the simulator
+    must be built with "make simulator DPI_ROM=1" so the boot ROM can be
+    replaced).
+
+Stock Spike has its own device map: a CLINT at 0x0200_0000, and no ns16550
+UART or PLIC.  mtime and mtimecmp are read from that CLINT and written to
+the GFE's; the UART and PLIC are left at their reset values in the RTL, and
+the program must not use them before the switch (it would fault in Spike).
+A program that drives the GFE devices, such as a GFE Linux boot, needs a
+Spike built with the GFE device map, which is not part of this repository
+(stock Spike will not do): --gfe_devices checks that Spike has them, and
+then also moves the UART and PLIC registers.  Device state Spike cannot
+report is left at its reset value in the RTL, with a warning.
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+import pexpect
+
+import gfeparameters
+
+# ================================================================
+# Registers moved from Spike to the RTL
+
+# Spike and OpenOCD names; OpenOCD calls x8 'fp'
+GPRS = [("ra", "ra"), ("sp", "sp"), ("gp", "gp"), ("tp", "tp"),
+        ("t0", "t0"), ("t1", "t1"), ("t2", "t2"), ("s0", "fp"), ("s1", "s1")] + \
+       [("a%d" % i, "a%d" % i) for i in range(8)] + \
+       [("s%d" % i, "s%d" % i) for i in range(2, 12)] + \
+       [("t%d" % i, "t%d" % i) for i in range(3, 7)]
+
+FPRS = ["ft%d" % i for i in range(8)] + ["fs0", "fs1"] + \
+       ["fa%d" % i for i in range(8)] + \
+       ["fs%d" % i for i in range(2, 12)] + \
+       ["ft%d" % i for i in range(8, 12)]
+
+# In the order written: PMP and trap setup before the translation and
+# status registers, counters last
+CSRS = ["pmpcfg0", "pmpaddr0", "pmpaddr1", "pmpaddr2", "pmpaddr3",
+        "medeleg", "mideleg", "mtvec", "mscratch", "mepc", "mcause", "mtval",
+        "mcounteren", "stvec", "sscratch", "sepc", "scause", "stval",
+        "scounteren", "satp", "mstatus", "mie", "mip",
+        "mcycle", "minstret"]
+
+FP_CSRS = ["fcsr"]
+
+PRIV_NAMES = {0: "U", 1: "S", 3: "M"}
+
+# Instruction parked in the boot ROM while the state is moved: 'j .'
+PARK_INSN = 0x0000006f
+
+# Spike's own CLINT (the offsets of mtimecmp and mtime are the GFE's)
+SPIKE_CLINT_BASE = 0x02000000
+
+# Memory model: 256-bit words from 0x8000_0000 (see elf_to_hex.c)
+MEM_BASE = 0x80000000
+MEM_SIZE = 0x80000000
+MEM_WORD_BYTES = 32
+
+# ================================================================
+# Help functions
+
+def warn(msg):
+    sys.stderr.write("WARNING: hybrid_sim: %s\n" % msg)
+
+def elf_xlen(path):
+    with open(path, "rb") as f:
+        ident = f.read(5)
+    if ident[:4] != "\x7fELF":
+        raise Exception("%s is not an ELF file" % path)
+    return 64 if ord(ident[4]) == 2 else 32
+
+def symbol_address(elf, symbol):
+    nm = os.path.expandvars("$RISCV/bin/riscv64-unknown-elf-nm")
+    output = subprocess.check_output([nm, elf])
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[2] == symbol:
+            return int(fields[0], 16)
+    raise Exception("Symbol %s not found in %s" % (symbol, elf))
+
+def dump_to_hex(dumps, hex_path):
+    """Writes the memory dumped by Spike ({base: file}) as a Mem.hex for the
+    memory model: non-zero 256-bit words only, each run preceded by its
+    '@' word address, and the last word, as elf_to_hex does."""
+    zero_word = "\0" * MEM_WORD_BYTES
+    chunk_size = 1 << 20
+    n_words = 0
+    with open(hex_path, "w") as out:
+        for base in sorted(dumps):
+            if base < MEM_BASE or base % MEM_WORD_BYTES != 0:
+                warn("memory at 0x%x not in the memory model; ignored" % base)
+                continue
+            next_index = None
+            offset = 0
+            with open(dumps[base], "rb") as f:
+                while True:
+                    chunk = f.read(chunk_size)
+                    if not chunk:
+                        break
+                    if chunk.count("\0") == len(chunk):
+                        offset += len(chunk)
+                        continue
+                    for i in range(0, len(chunk), MEM_WORD_BYTES):
+                        word = chunk[i:i + MEM_WORD_BYTES].ljust(MEM_WORD_BYTES, "\0")
+                        if word == zero_word:
+                            continue
+                        index = (base + offset + i - MEM_BASE) / MEM_WORD_BYTES
+                        if index >= MEM_SIZE / MEM_WORD_BYTES:
+                            break
+                        if index != next_index:
+                            out.write("@%07x\n" % index)
+                        out.write(word[::-1].encode("hex") + "\n")
+                        next_index = index + 1
+                        n_words += 1
+                    offset += len(chunk)
+        out.write("@%07x\n%s\n" % (MEM_SIZE / MEM_WORD_BYTES - 1,
+                                   "00" * MEM_WORD_BYTES))
+    return n_words
+
+# ================================================================
+# Spike, under its interactive debugger
+
+class SpikeIss(object):
+    prompt = r"(?:^|\n): "
+
+    def __init__(self, elf, isa, mem, dtb, workdir, timeout):
+        spike = os.path.expandvars("$RISCV/bin/spike")
+        cmd = [spike, "-d", "--isa=%s" % isa, "-m%s" % mem]
+        if dtb:
+            cmd.append("--dtb=%s" % dtb)
+        cmd.append(elf)
+        print "+", " ".join(cmd)
+        self.logfile = open(os.path.join(workdir, "spike.log"), "w")
+        self.child = pexpect.spawn(cmd[0], cmd[1:], cwd=workdir,
+                                   logfile=self.logfile, timeout=timeout)
+        self.child.setecho(False)
+        self.child.expect(self.prompt)
+
+    def command(self, cmd, timeout=-1):
+        """Returns the output of 'cmd', without the prompt"""
+        self.child.sendline(cmd)
+        self.child.expect(self.prompt, timeout=timeout)
+        return self.child.before.strip()
+
+    def value(self, cmd):
+        """Returns the number printed by 'cmd', or None if there is none"""
+        output = self.command(cmd)
+        for word in output.split():
+            if word.startswith("0x"):
+                try:
+                    return int(word, 16)
+                except ValueError:
+                    pass
+        return None
+
+    def run(self, insns=None, pc=None):
+        if pc is not None:
+            self.command("until pc 0 %x" % pc, timeout=None)
+        else:
+            self.command("rs %d" % insns, timeout=None)
+
+    def dump(self, workdir):
+        for f in glob.glob(os.path.join(workdir, "mem.0x*.bin")):
+            os.remove(f)
+        self.command("dump", timeout=None)
+        dumps = {}
+        for f in glob.glob(os.path.join(workdir, "mem.0x*.bin")):
+            dumps[int(os.path.basename(f)[4:-4], 16)] = f
+        return dumps
+
+    def quit(self):
+        self.child.sendline("q")
+        self.child.expect(pexpect.EOF)
+        self.logfile.close()
+
+def read_state(spike, xlen, has_fpu, args):
+    state = {"gpr": [], "fpr": [], "csr": [], "mmio": []}
+
+    state["pc"] = spike.value("pc 0")
+    if state["pc"] is None:
+        raise Exception("Could not read the PC from Spike")
+
+    for spike_name, ocd_name in GPRS:
+        state["gpr"].append((ocd_name, spike.value("reg 0 %s" % spike_name)))
+
+    for csr in CSRS + (FP_CSRS if has_fpu else []):
+        value = spike.value("reg 0 %s" % csr)
+        if value is None:
+            warn("CSR %s not readable in Spike; left at its reset value" % csr)
+        else:
+            state["csr"].append((csr, value))
+
+    if has_fpu:
+        for fpr in FPRS:
+            state["fpr"].append((fpr, spike.value("freg 0 %s" % fpr)))
+
+    # Privilege level: not every Spike reports it; otherwise guess from
+    # the PC (kernel addresses are in the upper half) and satp
+    priv = spike.value("priv 0")
+    if priv is None:
+        output = spike.command("priv 0")
+        if output in PRIV_NAMES.values():
+            priv = [p for p in PRIV_NAMES if PRIV_NAMES[p] == output][0]
+    if priv is None:
+        satp = dict(state["csr"]).get("satp", 0)
+        if state["pc"] >> (xlen - 1):
+            priv = 1
+        elif satp:
+            priv = 0
+        else:
+            priv = 3
+        warn("privilege level not reported by Spike; assuming %s"
+             % PRIV_NAMES[priv])
+    state["priv"] = priv
+
+    # Device registers, as 32-bit words read at spike_addr in Spike and
+    # written at (GFE) addr in the RTL: (addr, value, name)
+    def mmio(addr, name, spike_addr=None):
+        if spike_addr is None:
+            spike_addr = addr
+        value = spike.value("mem %x" % spike_addr)
+        if value is None:
+            warn("%s (0x%x) not readable in Spike; left at its reset value"
+                 % (name, spike_addr))
+        else:
+            state["mmio"].append((addr, value & 0xffffffff, name))
+
+    clint = gfeparameters.CLINT_BASE
+    spike_clint = clint if args.gfe_devices else SPIKE_CLINT_BASE
+    for offset, name in ((gfeparameters.CLINT_MTIMECMP, "mtimecmp"),
+                         (gfeparameters.CLINT_MTIME, "mtime")):
+        for half in (0, 4):
+            mmio(clint + offset + half, "CLINT %s+%d" % (name, half),
+                 spike_clint + offset + half)
+
+    if not args.gfe_devices:
+        warn("UART and PLIC not modelled by Spike (no --gfe_devices); "
+             "left at their reset values in the RTL")
+        return state
+
+    uart = gfeparameters.UART_BASE
+    for offset, name in ((gfeparameters.UART_LCR, "LCR"),
+                         (gfeparameters.UART_IER, "IER"),
+                         (gfeparameters.UART_MCR, "MCR"),
+                         (gfeparameters.UART_SCR, "SCR")):
+        mmio(uart + offset, "UART %s" % name)
+
+    plic = gfeparameters.PLIC_BASE
+    for source in range(1, gfeparameters.PLIC_NUM_INTERRUPTS + 1):
+        mmio(plic + gfeparameters.PLIC_PRIORITY_OFFSET + 4 * source,
+             "PLIC priority %d" % source)
+    for context in range(args.plic_contexts):
+        mmio(plic + gfeparameters.PLIC_ENABLE_OFFSET + 0x80 * context,
+             "PLIC enable %d" % context)
+        mmio(plic + gfeparameters.PLIC_THRESHOLD_OFFSET + 0x1000 * context,
+             "PLIC threshold %d" % context)
+
+    return state
+
+# ================================================================
+# OpenOCD, driven through its TCL RPC port
+
+class OpenocdRpc(object):
+    def __init__(self, port, vpi_port, workdir, timeout):
+        cfg = os.path.join(workdir, "hybrid_openocd.cfg")
+        with open(cfg, "w") as f:
+            f.write("interface jtag_vpi\n"
+                    "jtag_vpi_set_port %d\n"
+                    "jtag newtap riscv cpu -irlen 5 -expected-id 0x00000ffd\n"
+                    "target create riscv.cpu riscv -chain-position riscv.cpu\n"
+                    "riscv set_progbuf_no_blocks on\n"
+                    "riscv set_command_timeout_sec 30\n"
+                    "telnet_port disabled\n"
+                    "gdb_port disabled\n"
+                    "tcl_port %d\n"
+                    "init\n"
+                    "halt\n" % (vpi_port, port))
+        openocd = os.path.expandvars("$RISCV/bin/openocd")
+        self.logfile = open(os.path.join(workdir, "openocd.log"), "w")
+        self.process = subprocess.Popen([openocd, "-f", cfg],
+                                        stdout=self.logfile,
+                                        stderr=self.logfile)
+        start = time.time()
+        while True:
+            if self.process.poll() is not None:
+                raise Exception("OpenOCD exited early; see %s"
+                                % self.logfile.name)
+            try:
+                self.sock = socket.create_connection(("localhost", port))
+                break
+            except socket.error:
+                if time.time() - start > timeout:
+                    raise Exception("Timed out connecting to OpenOCD")
+                time.sleep(0.5)
+
+    def command(self, cmd):
+        self.sock.sendall(cmd + "\x1a")
+        data = ""
+        while not data.endswith("\x1a"):
+            chunk = self.sock.recv(4096)
+            if not chunk:
+                raise Exception("OpenOCD closed the connection")
+            data += chunk
+        return data[:-1]
+
+    def write_mem(self, addr, value):
+        self.command("mww 0x%x 0x%x" % (addr, value))
+
+    def write_reg(self, name, value):
+        output = self.command("reg %s 0x%x" % (name, value))
+        if "not found" in output or "failed" in output.lower():
+            warn("could not write %s: %s" % (name, output.strip()))
+
+    def close(self):
+        try:
+            self.sock.close()
+        except socket.error:
+            pass
+        if self.process.poll() is None:
+            self.process.terminate()
+            self.process.wait()
+        self.logfile.close()
+
+def write_state(ocd, state):
+    print "Writing device state"
+    mtime_lo = None
+    for addr, value, name in state["mmio"]:
+        if name == "CLINT mtime+0":
+            # Low half last, after a zero write, so that no carry into the
+            # high half is lost
+            mtime_lo = (addr, value)
+            ocd.write_mem(addr, 0)
+            continue
+        ocd.write_mem(addr, value)
+    if mtime_lo:
+        ocd.write_mem(*mtime_lo)
+
+    print "Writing CSRs, GPRs and FPRs"
+    for name, value in state["csr"]:
+        ocd.write_reg(name, value)
+    for name, value in state["gpr"] + state["fpr"]:
+        if value is not None:
+            ocd.write_reg(name, value)
+    ocd.write_reg("pc", state["pc"])
+    ocd.write_reg("priv", state["priv"])
+
+# ================================================================
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run an ELF in Spike up to a point, then continue it in "
+        "a Verilator simulator of the GFE (built with DPI_ROM=1).")
+    parser.add_argument("simulator", help="Verilator simulator executable")
+    parser.add_argument("elf", help="RISC-V ELF to run")
+    stop = parser.add_mutually_exclusive_group(required=True)
+    stop.add_argument("--insns", type=int,
+                      help="Instructions to run in Spike")
+    stop.add_argument("--pc", type=lambda s: int(s, 0),
+                      help="Run in Spike until this PC")
+    stop.add_argument("--symbol",
+                      help="Run in Spike until the address of this symbol")
+    parser.add_argument("--isa",
+                        help="Spike ISA (default: RV64IMAFDC for a 64-bit "
+                        "ELF, RV32IMAC for a 32-bit one)")
+    parser.add_argument("--mem", default="0xC0000000:0x40000000",
+                        help="Spike memory, base:size")
+    parser.add_argument("--gfe_devices", action="store_true",
+                        help="Spike is built with the GFE device map (CLINT, "
+                        "UART and PLIC at the GFE addresses): check that, and "
+                        "move the UART and PLIC state too")
+    parser.add_argument("--dtb", default="",
+                        help="Device tree for Spike (default: Spike's own; "
+                        "e.g. ../../bootrom/devicetree.dtb for --gfe_devices)")
+    parser.add_argument("--plic_contexts", type=int, default=2,
+                        help="PLIC contexts (M, S, ...) whose state is moved")
+    parser.add_argument("--max_cycles", type=int, default=0,
+                        help="Stop the RTL simulation after this many cycles")
+    parser.add_argument("--vpi_port", type=int, default=5555)
+    parser.add_argument("--tcl_port", type=int, default=6666)
+    parser.add_argument("--timeout", type=float, default=120,
+                        help="Seconds to wait for OpenOCD to connect")
+    parser.add_argument("--workdir",
+                        help="Directory for Mem.hex and logs (default: a "
+                        "new temporary directory)")
+    parser.add_argument("plusargs", nargs="*",
+                        help="Extra simulator arguments (after --)")
+    args = parser.parse_args()
+
+    for path in (args.simulator, args.elf):
+        if not os.path.exists(path):
+            raise Exception("Path {} does not exist".format(path))
+    simulator = os.path.abspath(args.simulator)
+    elf = os.path.abspath(args.elf)
+    dtb = os.path.abspath(args.dtb) if args.dtb else None
+
+    xlen = elf_xlen(elf)
+    isa = args.isa or ("RV64IMAFDC" if xlen == 64 else "RV32IMAC")
+    has_fpu = "F" in isa.upper()[4:] or "G" in isa.upper()[4:]
+
+    workdir = args.workdir or tempfile.mkdtemp(prefix="hybrid-")
+    if not os.path.isdir(workdir):
+        os.makedirs(workdir)
+    print "Working directory:", workdir
+
+    # ---------------- Spike
+    spike = SpikeIss(elf, isa, args.mem, dtb, workdir, args.timeout)
+    if args.gfe_devices:
+        uart_scr = gfeparameters.UART_BASE + gfeparameters.UART_SCR
+        if spike.value("mem %x" % uart_scr) is None:
+            spike.quit()
+            raise Exception("--gfe_devices: Spike has no UART at 0x%x; it "
+                            "must be built with the GFE device map"
+                            % gfeparameters.UART_BASE)
+    t0 = time.time()
+    if args.insns is not None:
+        print "Running %d instructions in Spike" % args.insns
+        spike.run(insns=args.insns)
+    else:
+        pc = args.pc if args.symbol is None else symbol_address(elf, args.symbol)
+        print "Running in Spike until PC 0x%x" % pc
+        spike.run(pc=pc)
+    print "Spike: %.1f s" % (time.time() - t0)
+
+    state = read_state(spike, xlen, has_fpu, args)
+    print "Spike stopped at PC 0x%x, privilege %s" % (
+        state["pc"], PRIV_NAMES[state["priv"]])
+    dumps = spike.dump(workdir)
+    spike.quit()
+
+    n_words = dump_to_hex(dumps, os.path.join(workdir, "Mem.hex"))
+    print "Mem.hex: %d non-zero 256-bit words" % n_words
+    for f in dumps.values():
+        os.remove(f)
+
+    park = os.path.join(workdir, "park.bin")
+    with open(park, "wb") as f:
+        f.write(struct.pack("<I", PARK_INSN))
+
+    # ---------------- RTL
+    cmd = [simulator, "+bootrom=park.bin", "+vpi_port=%d" % args.vpi_port]
+    if args.max_cycles:
+        cmd.append("+max_cycles=%d" % args.max_cycles)
+    cmd += args.plusargs
+    print "+", " ".join(cmd)
+    sim = subprocess.Popen(cmd, cwd=workdir)
+
+    ocd = None
+    try:
+        ocd = OpenocdRpc(args.tcl_port, args.vpi_port, workdir, args.timeout)
+        write_state(ocd, state)
+        print "Resuming in the RTL"
+        ocd.command("resume")
+        # OpenOCD stays connected until the simulation ends
+        sim.wait()
+    finally:
+        if ocd:
+            ocd.close()
+        if sim.poll() is None:
+            sim.terminate()
+            sim.wait()
+    return sim.returncode
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -282,6 +282,62 @@ class TestGfe(BaseGfeTest):
             )
         return
 
+    # Slots of bench_results in baremetal/asm/rv64ui/microbench.S:
+    # (instruction class, latency slot, throughput slot)
+    microbench_rows = [
+        ("add",              1,    2),
+        ("mul",              3,    4),
+        ("div",              5,    6),
+        ("load (hit)",       7,    8),
+        ("store (hit)",      None, 9),
+        ("store->load",      10,   None),
+        ("branch taken",     None, 11),
+        ("branch not taken", None, 12),
+        ("jal",              None, 13),
+        ("auipc+jalr",       None, 14),
+        ("csrrw / csrr",     15,   16),
+        ("fadd.d",           17,   18),
+        ("fmul.d",           19,   20),
+        ("fdiv.d",           21,   22),
+    ]
+    microbench_n_slots = 23
+    microbench_ops = 32 * 64    # BENCH_REPS * BENCH_OPS
+
+    def test_microbench(self):
+        """Run the instruction-class microbenchmarks and print a table of
+        cycles per operation: latency (dependent chain) and throughput
+        (independent operations). The table has the same rows on every
+        processor, so that P1/P2/P3 and Bluespec/Chisel cores can be compared.
+        """
+        elf = 'rv{}ui-p-microbench'.format(self.getXlen())
+        elf_path = os.path.abspath(os.path.join(self.path_to_asm, elf))
+        print("Running {}".format(elf_path))
+        self.gfe.gdb_session.command("file {}".format(elf_path))
+        self.gfe.gdb_session.load()
+        self.gfe.gdb_session.b("write_tohost")
+        self.gfe.gdb_session.c()
+        gp = self.gfe.gdb_session.p("$gp")
+        self.assertEqual(gp, 1, "microbench self-check failed (gp = {})".format(gp))
+
+        base = self.gfe.gdb_session.p("(unsigned long) &bench_results")
+        cycles = [self.gfe.riscvRead32(base + 4 * slot)
+            for slot in range(self.microbench_n_slots)]
+        overhead = cycles[0]
+
+        def per_op(slot):
+            if slot is None:
+                return "-"
+            if cycles[slot] == 0:
+                return "n/a"
+            return "{:.2f}".format(
+                float(cycles[slot] - overhead) / self.microbench_ops)
+
+        print("Cycles per operation (loop overhead {} cycles subtracted)".format(overhead))
+        print("{:<18} {:>10} {:>10}".format("class", "latency", "throughput"))
+        for (name, lat_slot, tput_slot) in self.microbench_rows:
+            print("{:<18} {:>10} {:>10}".format(
+                name, per_op(lat_slot), per_op(tput_slot)))
+
 # Create test classes for 64 and 32 bit processors
 class TestGfe32(TestGfe):
 
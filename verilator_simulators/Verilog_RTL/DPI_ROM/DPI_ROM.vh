@@ -0,0 +1,242 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Body of the boot ROM and flash models in this directory, which are
+// plug-compatible replacements for procs/<proc>/mkBoot_ROM.v and mkFlash.v
+// (selected by "make simulator PROC=<proc> DPI_ROM=1").  Instead of being
+// compiled into the model as a 'case' table, the contents are read from a
+// binary file at startup by c_rom_load (), and each read by c_rom_read ()
+// (src_C/C_Imported_Functions.c).  Bytes outside the file read as 8'hAA,
+// like the entries missing from the tables.
+//
+// Same AXI4 slave behaviour as the generated models: single-beat 64-bit
+// transfers; a read of 1, 2, 4 or 8 naturally aligned bytes within
+// [addr_base, addr_lim) returns the 64-bit word containing them, shifted
+// right to bit 0; other reads and all writes outside the range, or
+// misaligned, get SLVERR; other writes are acknowledged and ignored.
+//
+// The including file defines DPI_ROM_MODULE (module name), DPI_ROM_ID
+// (c_rom_load/c_rom_read 'rom' argument), DPI_ROM_NAME (for messages),
+// DPI_ROM_PLUSARG and DPI_ROM_OFFSET_PLUSARG ($value$plusargs formats for
+// the file name and the offset of its first byte in the device), and
+// DPI_ROM_DEFAULT_FILE and DPI_ROM_DEFAULT_OFFSET.  BOOT_ROM_FILE and
+// FLASH_FILE are defined on the verilator command line (see Makefile).
+
+`include "sim_rom.vh"
+
+`ifdef BSV_ASSIGNMENT_DELAY
+`else
+  `define BSV_ASSIGNMENT_DELAY
+`endif
+
+`ifdef BSV_POSITIVE_RESET
+  `define BSV_RESET_VALUE 1'b1
+`else
+  `define BSV_RESET_VALUE 1'b0
+`endif
+
+module `DPI_ROM_MODULE(
+  input          CLK,
+  input          RST_N,
+
+  input  [63:0]  set_addr_map_addr_base,
+  input  [63:0]  set_addr_map_addr_lim,
+  input          EN_set_addr_map,
+  output         RDY_set_addr_map,
+
+  input          slave_awvalid,
+  input  [ 3:0]  slave_awid,
+  input  [63:0]  slave_awaddr,
+  input  [ 7:0]  slave_awlen,
+  input  [ 2:0]  slave_awsize,
+  input  [ 1:0]  slave_awburst,
+  input          slave_awlock,
+  input  [ 3:0]  slave_awcache,
+  input  [ 2:0]  slave_awprot,
+  input  [ 3:0]  slave_awqos,
+  input  [ 3:0]  slave_awregion,
+  output         slave_awready,
+
+  input          slave_wvalid,
+  input  [63:0]  slave_wdata,
+  input  [ 7:0]  slave_wstrb,
+  input          slave_wlast,
+  output         slave_wready,
+
+  output         slave_bvalid,
+  output [ 3:0]  slave_bid,
+  output [ 1:0]  slave_bresp,
+  input          slave_bready,
+
+  input          slave_arvalid,
+  input  [ 3:0]  slave_arid,
+  input  [63:0]  slave_araddr,
+  input  [ 7:0]  slave_arlen,
+  input  [ 2:0]  slave_arsize,
+  input  [ 1:0]  slave_arburst,
+  input          slave_arlock,
+  input  [ 3:0]  slave_arcache,
+  input  [ 2:0]  slave_arprot,
+  input  [ 3:0]  slave_arqos,
+  input  [ 3:0]  slave_arregion,
+  output         slave_arready,
+
+  output         slave_rvalid,
+  output [ 3:0]  slave_rid,
+  output [63:0]  slave_rdata,
+  output [ 1:0]  slave_rresp,
+  output         slave_rlast,
+  input          slave_rready
+);
+
+   // ----------------
+   // Contents
+
+   string        filename;
+   reg    [63:0] offset;
+
+   initial begin
+      if ($value$plusargs(`DPI_ROM_PLUSARG, filename) == 0)
+	filename = `DPI_ROM_DEFAULT_FILE;
+      if ($value$plusargs(`DPI_ROM_OFFSET_PLUSARG, offset) == 0)
+	offset = `DPI_ROM_DEFAULT_OFFSET;
+
+      if (c_rom_load(`DPI_ROM_ID, filename, offset) == 0) begin
+	 $display("ERROR: %s: cannot load %s", `DPI_ROM_NAME, filename);
+	 $finish;
+      end
+   end
+
+   // ----------------
+   // Address map
+
+   reg    [63:0] rg_addr_base;
+   reg    [63:0] rg_addr_lim;
+   reg           rg_module_ready;
+
+   assign RDY_set_addr_map = 1'b1;
+
+   always @(posedge CLK) begin
+      if (RST_N == `BSV_RESET_VALUE)
+	rg_module_ready <= `BSV_ASSIGNMENT_DELAY 1'b0;
+      else if (EN_set_addr_map)
+	rg_module_ready <= `BSV_ASSIGNMENT_DELAY 1'b1;
+      if (EN_set_addr_map) begin
+	 rg_addr_base <= `BSV_ASSIGNMENT_DELAY set_addr_map_addr_base;
+	 rg_addr_lim  <= `BSV_ASSIGNMENT_DELAY set_addr_map_addr_lim;
+      end
+   end
+
+   function bad_addr(input [63:0] addr, input [2:0] size);
+      reg misaligned;
+      begin
+	 case (size)
+	   3'b000:  misaligned = 1'b0;
+	   3'b001:  misaligned = addr[0];
+	   3'b010:  misaligned = (addr[1:0] != 2'd0);
+	   3'b011:  misaligned = (addr[2:0] != 3'd0);
+	   default: misaligned = 1'b1;
+	 endcase
+	 bad_addr = misaligned || (addr < rg_addr_base) || (addr >= rg_addr_lim);
+      end
+   endfunction
+
+   // ----------------
+   // AXI4 channel buffers: {id, addr, len, size, burst, lock, cache, prot, qos, region}
+
+   wire [96:0] f_rd_addr_D_OUT, f_wr_addr_D_OUT;
+   wire [70:0] f_rd_data_D_OUT;
+   wire [ 5:0] f_wr_resp_D_OUT;
+   wire        f_rd_addr_FULL_N, f_rd_addr_EMPTY_N;
+   wire        f_rd_data_FULL_N, f_rd_data_EMPTY_N;
+   wire        f_wr_addr_FULL_N, f_wr_addr_EMPTY_N;
+   wire        f_wr_data_FULL_N, f_wr_data_EMPTY_N;
+   wire        f_wr_resp_FULL_N, f_wr_resp_EMPTY_N;
+
+   wire rd_fire = f_rd_addr_EMPTY_N && f_rd_data_FULL_N && rg_module_ready;
+   wire wr_fire = f_wr_addr_EMPTY_N && f_wr_data_EMPTY_N && f_wr_resp_FULL_N && rg_module_ready;
+
+   FIFO2 #(.width(32'd97), .guarded(32'd1))
+     f_rd_addr(.RST(RST_N), .CLK(CLK),
+	       .D_IN({slave_arid, slave_araddr, slave_arlen, slave_arsize, slave_arburst,
+		      slave_arlock, slave_arcache, slave_arprot, slave_arqos, slave_arregion}),
+	       .ENQ(slave_arvalid && f_rd_addr_FULL_N), .DEQ(rd_fire), .CLR(1'b0),
+	       .D_OUT(f_rd_addr_D_OUT), .FULL_N(f_rd_addr_FULL_N), .EMPTY_N(f_rd_addr_EMPTY_N));
+
+   FIFO2 #(.width(32'd97), .guarded(32'd1))
+     f_wr_addr(.RST(RST_N), .CLK(CLK),
+	       .D_IN({slave_awid, slave_awaddr, slave_awlen, slave_awsize, slave_awburst,
+		      slave_awlock, slave_awcache, slave_awprot, slave_awqos, slave_awregion}),
+	       .ENQ(slave_awvalid && f_wr_addr_FULL_N), .DEQ(wr_fire), .CLR(1'b0),
+	       .D_OUT(f_wr_addr_D_OUT), .FULL_N(f_wr_addr_FULL_N), .EMPTY_N(f_wr_addr_EMPTY_N));
+
+   FIFO2 #(.width(32'd73), .guarded(32'd1))
+     f_wr_data(.RST(RST_N), .CLK(CLK),
+	       .D_IN({slave_wdata, slave_wstrb, slave_wlast}),
+	       .ENQ(slave_wvalid && f_wr_data_FULL_N), .DEQ(wr_fire), .CLR(1'b0),
+	       .D_OUT(), .FULL_N(f_wr_data_FULL_N), .EMPTY_N(f_wr_data_EMPTY_N));
+
+   // ----------------
+   // Reads
+
+   wire [63:0] rd_addr   = f_rd_addr_D_OUT[92:29];
+   wire [ 2:0] rd_size   = f_rd_addr_D_OUT[20:18];
+   wire        rd_err    = bad_addr(rd_addr, rd_size);
+   wire [63:0] rd_offset = rd_addr - rg_addr_base;
+   wire [63:0] data64    = c_rom_read(`DPI_ROM_ID, {rd_offset[63:3], 3'b000});
+   wire [63:0] rdata     = rd_err ? data64 : (data64 >> {rd_addr[2:0], 3'b000});
+
+   FIFO2 #(.width(32'd71), .guarded(32'd1))
+     f_rd_data(.RST(RST_N), .CLK(CLK),
+	       .D_IN({f_rd_addr_D_OUT[96:93], rdata, (rd_err ? 2'b10 : 2'b00), 1'b1}),
+	       .ENQ(rd_fire), .DEQ(slave_rready && f_rd_data_EMPTY_N), .CLR(1'b0),
+	       .D_OUT(f_rd_data_D_OUT), .FULL_N(f_rd_data_FULL_N), .EMPTY_N(f_rd_data_EMPTY_N));
+
+   // ----------------
+   // Writes (acknowledged, ignored)
+
+   wire wr_err = bad_addr(f_wr_addr_D_OUT[92:29], f_wr_addr_D_OUT[20:18]);
+
+   FIFO2 #(.width(32'd6), .guarded(32'd1))
+     f_wr_resp(.RST(RST_N), .CLK(CLK),
+	       .D_IN({f_wr_addr_D_OUT[96:93], (wr_err ? 2'b10 : 2'b00)}),
+	       .ENQ(wr_fire), .DEQ(slave_bready && f_wr_resp_EMPTY_N), .CLR(1'b0),
+	       .D_OUT(f_wr_resp_D_OUT), .FULL_N(f_wr_resp_FULL_N), .EMPTY_N(f_wr_resp_EMPTY_N));
+
+   // ----------------
+   // Outputs
+
+   assign slave_awready = f_wr_addr_FULL_N;
+   assign slave_wready  = f_wr_data_FULL_N;
+
+   assign slave_bvalid  = f_wr_resp_EMPTY_N;
+   assign slave_bid     = f_wr_resp_D_OUT[5:2];
+   assign slave_bresp   = f_wr_resp_D_OUT[1:0];
+
+   assign slave_arready = f_rd_addr_FULL_N;
+
+   assign slave_rvalid  = f_rd_data_EMPTY_N;
+   assign slave_rid     = f_rd_data_D_OUT[70:67];
+   assign slave_rdata   = f_rd_data_D_OUT[66:3];
+   assign slave_rresp   = f_rd_data_D_OUT[2:1];
+   assign slave_rlast   = f_rd_data_D_OUT[0];
+
+   // synopsys translate_off
+   always @(negedge CLK) begin
+      if ((RST_N != `BSV_RESET_VALUE) && rd_fire && rd_err)
+	$display("%0d: ERROR: %s: unrecognized or misaligned read addr 0x%0h, arsize %0d",
+		 $stime, `DPI_ROM_NAME, rd_addr, rd_size);
+      if ((RST_N != `BSV_RESET_VALUE) && wr_fire)
+	$display("%0d: ERROR: %s: write to addr 0x%0h ignored",
+		 $stime, `DPI_ROM_NAME, f_wr_addr_D_OUT[92:29]);
+   end
+   // synopsys translate_on
+
+endmodule
+
+`undef DPI_ROM_MODULE
+`undef DPI_ROM_ID
+`undef DPI_ROM_NAME
+`undef DPI_ROM_PLUSARG
+`undef DPI_ROM_OFFSET_PLUSARG
+`undef DPI_ROM_DEFAULT_FILE
+`undef DPI_ROM_DEFAULT_OFFSET
@@ -0,0 +1,15 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Boot ROM whose contents are loaded at startup (see DPI_ROM.vh):
+//     +bootrom=<file>            (default: procs/<proc>/boot_rom.bin)
+//     +bootrom_offset=<offset>   (default: 0)
+
+`define DPI_ROM_MODULE          mkBoot_ROM
+`define DPI_ROM_ID              0
+`define DPI_ROM_NAME            "Boot_ROM"
+`define DPI_ROM_PLUSARG         "bootrom=%s"
+`define DPI_ROM_OFFSET_PLUSARG  "bootrom_offset=%h"
+`define DPI_ROM_DEFAULT_FILE    `BOOT_ROM_FILE
+`define DPI_ROM_DEFAULT_OFFSET  64'h0
+
+`include "DPI_ROM.vh"
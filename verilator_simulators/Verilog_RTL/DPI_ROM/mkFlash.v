@@ -0,0 +1,16 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Flash memory whose contents are loaded at startup (see DPI_ROM.vh):
+//     +flash=<file>              (default: procs/<proc>/flash.bin)
+//     +flash_offset=<offset>     (default: 4000000, i.e. the image starts
+//                                 at 0x_4400_0000, where the boot ROM jumps)
+
+`define DPI_ROM_MODULE          mkFlash
+`define DPI_ROM_ID              1
+`define DPI_ROM_NAME            "Flash"
+`define DPI_ROM_PLUSARG         "flash=%s"
+`define DPI_ROM_OFFSET_PLUSARG  "flash_offset=%h"
+`define DPI_ROM_DEFAULT_FILE    `FLASH_FILE
+`define DPI_ROM_DEFAULT_OFFSET  64'h4000000
+
+`include "DPI_ROM.vh"
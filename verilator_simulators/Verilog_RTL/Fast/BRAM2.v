@@ -0,0 +1,109 @@
+
+// Copyright (c) 2000-2019 Bluespec, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// Verilator-oriented version of ../BRAM2.v (see README.txt)
+
+`ifdef BSV_ASSIGNMENT_DELAY
+`else
+ `define BSV_ASSIGNMENT_DELAY
+`endif
+
+// Dual-Ported BRAM (WRITE FIRST)
+module BRAM2(CLKA,
+             ENA,
+             WEA,
+             ADDRA,
+             DIA,
+             DOA,
+             CLKB,
+             ENB,
+             WEB,
+             ADDRB,
+             DIB,
+             DOB
+             );
+
+   parameter                      PIPELINED  = 0;
+   parameter                      ADDR_WIDTH = 1;
+   parameter                      DATA_WIDTH = 1;
+   parameter                      MEMSIZE    = 1;
+
+   input                          CLKA;
+   input                          ENA;
+   input                          WEA;
+   input [ADDR_WIDTH-1:0]         ADDRA;
+   input [DATA_WIDTH-1:0]         DIA;
+   output [DATA_WIDTH-1:0]        DOA;
+
+   input                          CLKB;
+   input                          ENB;
+   input                          WEB;
+   input [ADDR_WIDTH-1:0]         ADDRB;
+   input [DATA_WIDTH-1:0]         DIB;
+   output [DATA_WIDTH-1:0]        DOB;
+
+   reg [DATA_WIDTH-1:0]           RAM[0:MEMSIZE-1];
+   reg [DATA_WIDTH-1:0]           DOA_R;
+   reg [DATA_WIDTH-1:0]           DOB_R;
+
+   always @(posedge CLKA) begin
+      if (ENA) begin
+         if (WEA) begin
+            RAM[ADDRA] <= `BSV_ASSIGNMENT_DELAY DIA;
+            DOA_R <= `BSV_ASSIGNMENT_DELAY DIA;
+         end
+         else begin
+            DOA_R <= `BSV_ASSIGNMENT_DELAY RAM[ADDRA];
+         end
+      end
+   end
+
+   always @(posedge CLKB) begin
+      if (ENB) begin
+         if (WEB) begin
+            RAM[ADDRB] <= `BSV_ASSIGNMENT_DELAY DIB;
+            DOB_R <= `BSV_ASSIGNMENT_DELAY DIB;
+         end
+         else begin
+            DOB_R <= `BSV_ASSIGNMENT_DELAY RAM[ADDRB];
+         end
+      end
+   end
+
+   // The second output stage exists only when PIPELINED
+   generate
+      if (PIPELINED) begin : pipe
+         reg [DATA_WIDTH-1:0]     DOA_R2;
+         reg [DATA_WIDTH-1:0]     DOB_R2;
+
+         always @(posedge CLKA) DOA_R2 <= `BSV_ASSIGNMENT_DELAY DOA_R;
+         always @(posedge CLKB) DOB_R2 <= `BSV_ASSIGNMENT_DELAY DOB_R;
+
+         assign DOA = DOA_R2;
+         assign DOB = DOB_R2;
+      end
+      else begin : no_pipe
+         assign DOA = DOA_R;
+         assign DOB = DOB_R;
+      end
+   endgenerate
+
+endmodule // BRAM2
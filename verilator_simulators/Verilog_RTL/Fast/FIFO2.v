@@ -0,0 +1,132 @@
+
+// Copyright (c) 2000-2019 Bluespec, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// Verilator-oriented version of ../FIFO2.v (see README.txt)
+
+`ifdef BSV_ASSIGNMENT_DELAY
+`else
+  `define BSV_ASSIGNMENT_DELAY
+`endif
+
+`ifdef BSV_POSITIVE_RESET
+  `define BSV_RESET_VALUE 1'b1
+  `define BSV_RESET_EDGE posedge
+`else
+  `define BSV_RESET_VALUE 1'b0
+  `define BSV_RESET_EDGE negedge
+`endif
+
+`ifdef BSV_ASYNC_RESET
+ `define BSV_ARESET_EDGE_META or `BSV_RESET_EDGE RST
+`else
+ `define BSV_ARESET_EDGE_META
+`endif
+
+// Depth 2 FIFO
+module FIFO2(CLK,
+             RST,
+             D_IN,
+             ENQ,
+             FULL_N,
+             D_OUT,
+             DEQ,
+             EMPTY_N,
+             CLR);
+
+   parameter width = 1;
+   parameter guarded = 1;
+
+   input     CLK ;
+   input     RST ;
+   input [width - 1 : 0] D_IN;
+   input                 ENQ;
+   input                 DEQ;
+   input                 CLR ;
+
+   output                FULL_N;
+   output                EMPTY_N;
+   output [width - 1 : 0] D_OUT;
+
+   reg                    full_reg;
+   reg                    empty_reg;
+   reg                    head;
+   reg                    tail;
+   reg [width - 1 : 0]    arr[0:1];
+
+   assign                 FULL_N = full_reg ;
+   assign                 EMPTY_N = empty_reg ;
+   assign                 D_OUT = arr[head] ;
+
+   always@(posedge CLK `BSV_ARESET_EDGE_META)
+     begin
+        if (RST == `BSV_RESET_VALUE)
+          begin
+             empty_reg <= `BSV_ASSIGNMENT_DELAY 1'b0;
+             full_reg  <= `BSV_ASSIGNMENT_DELAY 1'b1;
+             head      <= `BSV_ASSIGNMENT_DELAY 1'b0;
+             tail      <= `BSV_ASSIGNMENT_DELAY 1'b0;
+          end
+        else if (CLR)
+          begin
+             empty_reg <= `BSV_ASSIGNMENT_DELAY 1'b0;
+             full_reg  <= `BSV_ASSIGNMENT_DELAY 1'b1;
+             head      <= `BSV_ASSIGNMENT_DELAY 1'b0;
+             tail      <= `BSV_ASSIGNMENT_DELAY 1'b0;
+          end
+        else
+          begin
+             if (ENQ) tail <= `BSV_ASSIGNMENT_DELAY ! tail;
+             if (DEQ) head <= `BSV_ASSIGNMENT_DELAY ! head;
+
+             if ( ENQ && ! DEQ ) // just enq
+               begin
+                  empty_reg <= `BSV_ASSIGNMENT_DELAY 1'b1;
+                  full_reg  <= `BSV_ASSIGNMENT_DELAY ! empty_reg ;
+               end
+             else if ( DEQ && ! ENQ ) // just deq
+               begin
+                  full_reg  <= `BSV_ASSIGNMENT_DELAY 1'b1;
+                  empty_reg <= `BSV_ASSIGNMENT_DELAY ! full_reg;
+               end
+          end
+     end
+
+   // Only the entry being enqueued is written
+   always@(posedge CLK)
+     begin
+        if (ENQ)
+          arr[tail] <= `BSV_ASSIGNMENT_DELAY D_IN;
+     end
+
+`ifdef BSV_FAST_PRIM_CHECKS
+   always@(posedge CLK)
+     begin
+        if (RST == ! `BSV_RESET_VALUE)
+          begin
+             if ( ! empty_reg && DEQ )
+               $display( "Warning: FIFO2: %m -- Dequeuing from empty fifo" ) ;
+             if ( ! full_reg && ENQ && (!DEQ || guarded) )
+               $display( "Warning: FIFO2: %m -- Enqueuing to a full fifo" ) ;
+          end
+     end
+`endif
+
+endmodule
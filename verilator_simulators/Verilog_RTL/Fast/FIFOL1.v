@@ -0,0 +1,102 @@
+
+// Copyright (c) 2000-2019 Bluespec, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// Verilator-oriented version of ../FIFOL1.v (see README.txt)
+
+`ifdef BSV_ASSIGNMENT_DELAY
+`else
+  `define BSV_ASSIGNMENT_DELAY
+`endif
+
+`ifdef BSV_POSITIVE_RESET
+  `define BSV_RESET_VALUE 1'b1
+  `define BSV_RESET_EDGE posedge
+`else
+  `define BSV_RESET_VALUE 1'b0
+  `define BSV_RESET_EDGE negedge
+`endif
+
+`ifdef BSV_ASYNC_RESET
+ `define BSV_ARESET_EDGE_META or `BSV_RESET_EDGE RST
+`else
+ `define BSV_ARESET_EDGE_META
+`endif
+
+// Depth 1 pipeline FIFO (enq allowed when full if deq in the same cycle)
+module FIFOL1(CLK,
+              RST,
+              D_IN,
+              ENQ,
+              FULL_N,
+              D_OUT,
+              DEQ,
+              EMPTY_N,
+              CLR);
+
+   parameter             width = 1;
+
+   input                 CLK;
+   input                 RST;
+
+   input [width - 1 : 0] D_IN;
+   input                 ENQ;
+   input                 DEQ;
+   input                 CLR ;
+
+   output                FULL_N;
+   output                EMPTY_N;
+   output [width - 1 : 0] D_OUT;
+
+   reg                    empty_reg ;
+   reg [width - 1 : 0]    D_OUT;
+
+   assign FULL_N = !empty_reg || DEQ;
+   assign EMPTY_N = empty_reg ;
+
+   always@(posedge CLK `BSV_ARESET_EDGE_META)
+     begin
+        if (RST == `BSV_RESET_VALUE)
+          empty_reg <= `BSV_ASSIGNMENT_DELAY 1'b0;
+        else if (CLR)
+          empty_reg <= `BSV_ASSIGNMENT_DELAY 1'b0;
+        else if (ENQ)
+          empty_reg <= `BSV_ASSIGNMENT_DELAY 1'b1;
+        else if (DEQ)
+          empty_reg <= `BSV_ASSIGNMENT_DELAY 1'b0;
+     end
+
+   always@(posedge CLK)
+     begin
+        if (ENQ)
+          D_OUT <= `BSV_ASSIGNMENT_DELAY D_IN;
+     end
+
+`ifdef BSV_FAST_PRIM_CHECKS
+   always@(posedge CLK)
+     begin
+        if ( ! empty_reg && DEQ )
+          $display( "Warning: FIFOL1: %m -- Dequeuing from empty fifo" ) ;
+        if ( ! FULL_N && ENQ && ! DEQ)
+          $display( "Warning: FIFOL1: %m -- Enqueuing to a full fifo" ) ;
+     end
+`endif
+
+endmodule
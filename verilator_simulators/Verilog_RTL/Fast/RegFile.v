@@ -0,0 +1,91 @@
+
+// Copyright (c) 2000-2019 Bluespec, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// Verilator-oriented version of ../RegFile.v (see README.txt)
+
+`ifdef BSV_ASSIGNMENT_DELAY
+`else
+`define BSV_ASSIGNMENT_DELAY
+`endif
+
+
+// Multi-ported Register File
+module RegFile(CLK,
+               ADDR_IN, D_IN, WE,
+               ADDR_1, D_OUT_1,
+               ADDR_2, D_OUT_2,
+               ADDR_3, D_OUT_3,
+               ADDR_4, D_OUT_4,
+               ADDR_5, D_OUT_5
+               );
+   parameter                   addr_width = 1;
+   parameter                   data_width = 1;
+   parameter                   lo = 0;
+   parameter                   hi = 1;
+
+   // The array is zero-based and rounded up to a power of 2, and indexed
+   // by the low bits of (ADDR - lo), so that no bounds checks are needed
+   localparam                  iw = (hi > lo) ? $clog2(hi - lo + 1) : 1;
+
+   input                       CLK;
+   input [addr_width - 1 : 0]  ADDR_IN;
+   input [data_width - 1 : 0]  D_IN;
+   input                       WE;
+
+   input [addr_width - 1 : 0]  ADDR_1;
+   output [data_width - 1 : 0] D_OUT_1;
+
+   input [addr_width - 1 : 0]  ADDR_2;
+   output [data_width - 1 : 0] D_OUT_2;
+
+   input [addr_width - 1 : 0]  ADDR_3;
+   output [data_width - 1 : 0] D_OUT_3;
+
+   input [addr_width - 1 : 0]  ADDR_4;
+   output [data_width - 1 : 0] D_OUT_4;
+
+   input [addr_width - 1 : 0]  ADDR_5;
+   output [data_width - 1 : 0] D_OUT_5;
+
+   reg [data_width - 1 : 0]    arr[0 : (1 << iw) - 1];
+
+   function [iw - 1 : 0] index;
+      input [addr_width - 1 : 0] addr;
+      reg   [addr_width - 1 : 0] offset;
+      begin
+         offset = addr - lo;
+         index  = offset[iw - 1 : 0];
+      end
+   endfunction
+
+   always@(posedge CLK)
+     begin
+        if (WE)
+          arr[index(ADDR_IN)] <= `BSV_ASSIGNMENT_DELAY D_IN;
+     end // always@ (posedge CLK)
+
+   assign D_OUT_1 = arr[index(ADDR_1)];
+   assign D_OUT_2 = arr[index(ADDR_2)];
+   assign D_OUT_3 = arr[index(ADDR_3)];
+   assign D_OUT_4 = arr[index(ADDR_4)];
+   assign D_OUT_5 = arr[index(ADDR_5)];
+
+endmodule
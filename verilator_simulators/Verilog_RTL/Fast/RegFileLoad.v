@@ -0,0 +1,121 @@
+
+// Copyright (c) 2000-2019 Bluespec, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// Verilator-oriented version of ../RegFileLoad.v (see README.txt)
+
+`include "sim_regfile.vh"
+
+`ifdef BSV_ASSIGNMENT_DELAY
+`else
+`define BSV_ASSIGNMENT_DELAY
+`endif
+
+
+// Multi-ported Register File -- initializable from a file.
+// The contents are held by src_C/sim_regfile.cpp, which allocates only the
+// parts written or loaded from the file, and are read and written 64 bits
+// at a time through DPI-C.
+module RegFileLoad(CLK,
+                   ADDR_IN, D_IN, WE,
+                   ADDR_1, D_OUT_1,
+                   ADDR_2, D_OUT_2,
+                   ADDR_3, D_OUT_3,
+                   ADDR_4, D_OUT_4,
+                   ADDR_5, D_OUT_5
+                   );
+   parameter                   file = "";
+   parameter                   addr_width = 1;
+   parameter                   data_width = 1;
+   parameter                   lo = 0;
+   parameter                   hi = 1;
+   parameter                   binary = 0;
+
+   localparam                  n_words = (data_width + 63) / 64;
+
+   input                       CLK;
+   input [addr_width - 1 : 0]  ADDR_IN;
+   input [data_width - 1 : 0]  D_IN;
+   input                       WE;
+
+   input [addr_width - 1 : 0]  ADDR_1;
+   output [data_width - 1 : 0] D_OUT_1;
+
+   input [addr_width - 1 : 0]  ADDR_2;
+   output [data_width - 1 : 0] D_OUT_2;
+
+   input [addr_width - 1 : 0]  ADDR_3;
+   output [data_width - 1 : 0] D_OUT_3;
+
+   input [addr_width - 1 : 0]  ADDR_4;
+   output [data_width - 1 : 0] D_OUT_4;
+
+   input [addr_width - 1 : 0]  ADDR_5;
+   output [data_width - 1 : 0] D_OUT_5;
+
+   reg [31:0]                  handle;
+
+   // Incremented on every write, so that the read ports (whose DPI-C
+   // calls Verilator cannot see into) are evaluated again
+   reg [31:0]                  n_writes;
+
+   initial
+     begin : init_rom_block
+        n_writes = 0;
+        handle   = c_regfile_open($sformatf("%0s", file), binary, data_width, lo, hi);
+        if (handle == 0)
+          $finish;
+     end // initial begin
+
+   function [data_width - 1 : 0] read_entry;
+      input [addr_width - 1 : 0] addr;
+      input [31:0]               gen;
+      reg [n_words * 64 - 1 : 0] data;
+      integer                    j;
+      begin
+         for (j = 0; j < n_words; j = j + 1)
+           data[j * 64 +: 64] = c_regfile_read(handle, addr, j, gen);
+         read_entry = data[data_width - 1 : 0];
+      end
+   endfunction
+
+   always@(posedge CLK)
+     begin : write_block
+        reg [n_words * 64 - 1 : 0] data;
+        integer                    j;
+        if (WE)
+          begin
+             data = 0;
+             data[data_width - 1 : 0] = D_IN;
+             for (j = 0; j < n_words; j = j + 1)
+               c_regfile_write(handle, ADDR_IN, j, data[j * 64 +: 64]);
+             n_writes <= `BSV_ASSIGNMENT_DELAY n_writes + 1;
+          end
+     end // always@ (posedge CLK)
+
+   reg [data_width - 1 : 0]    D_OUT_1, D_OUT_2, D_OUT_3, D_OUT_4, D_OUT_5;
+
+   always @(*) D_OUT_1 = read_entry(ADDR_1, n_writes);
+   always @(*) D_OUT_2 = read_entry(ADDR_2, n_writes);
+   always @(*) D_OUT_3 = read_entry(ADDR_3, n_writes);
+   always @(*) D_OUT_4 = read_entry(ADDR_4, n_writes);
+   always @(*) D_OUT_5 = read_entry(ADDR_5, n_writes);
+
+endmodule
@@ -0,0 +1,135 @@
+
+// Copyright (c) 2000-2019 Bluespec, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// Verilator-oriented version of ../SizedFIFO.v (see README.txt)
+
+`ifdef BSV_ASSIGNMENT_DELAY
+`else
+  `define BSV_ASSIGNMENT_DELAY
+`endif
+
+`ifdef BSV_POSITIVE_RESET
+  `define BSV_RESET_VALUE 1'b1
+  `define BSV_RESET_EDGE posedge
+`else
+  `define BSV_RESET_VALUE 1'b0
+  `define BSV_RESET_EDGE negedge
+`endif
+
+`ifdef BSV_ASYNC_RESET
+ `define BSV_ARESET_EDGE_META or `BSV_RESET_EDGE RST
+`else
+ `define BSV_ARESET_EDGE_META
+`endif
+
+// Sized fifo: a circular buffer of p2depth entries, read through the head
+// pointer (the original keeps p2depth-1 entries plus an output register)
+module SizedFIFO(CLK, RST, D_IN, ENQ, FULL_N, D_OUT, DEQ, EMPTY_N, CLR);
+   parameter               p1width = 1; // data width
+   parameter               p2depth = 3;
+   parameter               p3cntr_width = 1; // log(p2depth-1); unused here
+   parameter               guarded = 1;
+
+   // As in the original, depths below 2 are increased to 2
+   localparam              depth = (p2depth >= 2) ? p2depth : 2 ;
+   localparam              iw    = $clog2(depth) ;
+
+   input                   CLK;
+   input                   RST;
+   input                   CLR;
+   input [p1width - 1 : 0] D_IN;
+   input                   ENQ;
+   input                   DEQ;
+
+   output                  FULL_N;
+   output                  EMPTY_N;
+   output [p1width - 1 : 0] D_OUT;
+
+   reg [p1width - 1 : 0]   arr[0 : depth - 1];
+
+   reg [iw - 1 : 0]        head;
+   reg [iw - 1 : 0]        tail;
+   reg                     not_full;
+   reg                     not_empty;
+
+   wire [iw - 1 : 0]       last      = depth - 1 ;
+   wire [iw - 1 : 0]       next_head = (head == last) ? {iw {1'b0}} : head + 1'b1 ;
+   wire [iw - 1 : 0]       next_tail = (tail == last) ? {iw {1'b0}} : tail + 1'b1 ;
+
+   assign    EMPTY_N = not_empty;
+   assign    FULL_N  = not_full;
+   assign    D_OUT   = arr[head];
+
+   always @(posedge CLK `BSV_ARESET_EDGE_META)
+     begin
+        if (RST == `BSV_RESET_VALUE)
+          begin
+             head      <= `BSV_ASSIGNMENT_DELAY {iw {1'b0}} ;
+             tail      <= `BSV_ASSIGNMENT_DELAY {iw {1'b0}} ;
+             not_full  <= `BSV_ASSIGNMENT_DELAY 1'b1;
+             not_empty <= `BSV_ASSIGNMENT_DELAY 1'b0;
+          end
+        else if (CLR)
+          begin
+             head      <= `BSV_ASSIGNMENT_DELAY {iw {1'b0}} ;
+             tail      <= `BSV_ASSIGNMENT_DELAY {iw {1'b0}} ;
+             not_full  <= `BSV_ASSIGNMENT_DELAY 1'b1;
+             not_empty <= `BSV_ASSIGNMENT_DELAY 1'b0;
+          end
+        else
+          begin
+             if (ENQ) tail <= `BSV_ASSIGNMENT_DELAY next_tail;
+             if (DEQ) head <= `BSV_ASSIGNMENT_DELAY next_head;
+
+             if (ENQ && ! DEQ)
+               begin
+                  not_empty <= `BSV_ASSIGNMENT_DELAY 1'b1;
+                  not_full  <= `BSV_ASSIGNMENT_DELAY next_tail != head ;
+               end
+             else if (DEQ && ! ENQ)
+               begin
+                  not_full  <= `BSV_ASSIGNMENT_DELAY 1'b1;
+                  not_empty <= `BSV_ASSIGNMENT_DELAY next_head != tail ;
+               end
+          end
+     end
+
+   // Only the entry being enqueued is written
+   always @(posedge CLK)
+     begin
+        if (ENQ)
+          arr[tail] <= `BSV_ASSIGNMENT_DELAY D_IN;
+     end
+
+`ifdef BSV_FAST_PRIM_CHECKS
+   always@(posedge CLK)
+     begin
+        if (RST == ! `BSV_RESET_VALUE)
+           begin
+              if ( ! EMPTY_N && DEQ )
+                $display( "Warning: SizedFIFO: %m -- Dequeuing from empty fifo" ) ;
+              if ( ! FULL_N && ENQ && (!DEQ || guarded) )
+                $display( "Warning: SizedFIFO: %m -- Enqueuing to a full fifo" ) ;
+           end
+     end
+`endif
+
+endmodule
@@ -0,0 +1,249 @@
+
+// Copyright (c) 2000-2019 Bluespec, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// Verilator-oriented version of ../SyncFIFOLevel.v (see README.txt)
+
+`ifdef BSV_ASSIGNMENT_DELAY
+`else
+  `define BSV_ASSIGNMENT_DELAY
+`endif
+
+`ifdef BSV_POSITIVE_RESET
+  `define BSV_RESET_VALUE 1'b1
+  `define BSV_RESET_EDGE posedge
+`else
+  `define BSV_RESET_VALUE 1'b0
+  `define BSV_RESET_EDGE negedge
+`endif
+
+
+// A clock synchronization FIFO where the enqueue and dequeue sides are in
+// different clock domains, with the same FULL, EMPTY and count latencies
+// as the original.  The original passes Gray-coded pointers through its
+// two-stage synchronizers; in simulation there is no metastability, so
+// the binary pointers are passed instead and give the same values on the
+// other side (full is "pointers differ only in the MSB", the Gray test
+// with the two top bits inverted).
+module SyncFIFOLevel(
+                     sCLK,
+                     sRST,
+                     dCLK,
+                     sENQ,
+                     sD_IN,
+                     sFULL_N,
+                     dDEQ,
+                     dD_OUT,
+                     dEMPTY_N,
+                     dCOUNT,
+                     sCOUNT,
+                     sCLR,
+                     sCLR_RDY,
+                     dCLR,
+                     dCLR_RDY
+                ) ;
+
+
+   parameter                 dataWidth = 1 ;
+   parameter                 depth = 2 ; // minimum 2
+   parameter                 indxWidth = 1 ; // minimum 1
+
+   input                     sCLK ;
+   input                     sRST ;
+   input                     sENQ ;
+   input [dataWidth -1 : 0]  sD_IN ;
+   output                    sFULL_N ;
+
+   input                     dCLK ;
+   input                     dDEQ ;
+   output                    dEMPTY_N ;
+   output [dataWidth -1 : 0] dD_OUT ;
+
+   output [indxWidth : 0]    dCOUNT;
+   output [indxWidth : 0]    sCOUNT;
+
+   input                     sCLR;
+   output                    sCLR_RDY;
+   input                     dCLR;
+   output                    dCLR_RDY;
+
+   wire [indxWidth : 0]      msbset  = ~({(indxWidth + 1){1'b1}} >> 1) ;
+
+   reg [dataWidth -1 : 0]    fifoMem [0: depth -1 ] ;
+   reg [dataWidth -1 : 0]    dDoutReg ;
+
+   reg [indxWidth : 0]       sEnqPtr ;             // binary
+   reg                       sNotFullReg ;
+   reg [indxWidth : 0]       sCountReg ;
+   reg [indxWidth : 0]       sSyncReg1, sDeqPtr ;  // dDeqPtr, synchronized
+
+   reg [indxWidth : 0]       dDeqPtr ;             // binary
+   reg                       dNotEmptyReg ;
+   reg [indxWidth : 0]       dCountReg ;
+   reg [indxWidth : 0]       dSyncReg1, dEnqPtr ;  // sEnqPtr, synchronized
+
+   wire [indxWidth : 0]      sNextEnqPtr  = sEnqPtr + 1'b1 ;
+   wire [indxWidth : 0]      dNextDeqPtr  = dDeqPtr + 1'b1 ;
+   wire                      dNextNotEmpty = dDeqPtr != dEnqPtr ;
+   wire [indxWidth : 0]      dNextCnt      = dEnqPtr - dDeqPtr ;
+
+   wire                      dRST = sRST;
+   wire                      sCLRSynced; // dCLR synced to sCLK
+   wire                      sCLR_RDY_int;
+   wire                      dCLRSynced; // sCLR synced to dCLK
+   wire                      dCLR_RDY_int;
+
+   SyncHandshake #(.delayreturn(1))
+   sClrSync ( .sCLK(sCLK),
+              .sRST(sRST),
+              .dCLK(dCLK),
+              .sEN(sCLR),
+              .sRDY(sCLR_RDY_int),
+              .dPulse(dCLRSynced));
+
+   SyncHandshake #(.delayreturn(1))
+   dClrSync ( .sCLK(dCLK),
+              .sRST(sRST),
+              .dCLK(sCLK),
+              .sEN(dCLR),
+              .sRDY(dCLR_RDY_int),
+              .dPulse(sCLRSynced));
+
+   wire                      sClear = sCLR || !sCLR_RDY_int || sCLRSynced;
+   wire                      dClear = dCLR || !dCLR_RDY_int || dCLRSynced;
+
+   assign                    dD_OUT   = dDoutReg;
+   assign                    dEMPTY_N = dNotEmptyReg ;
+   assign                    sFULL_N  = sNotFullReg ;
+   assign                    sCOUNT   = sCountReg;
+   assign                    dCOUNT   = dCountReg;
+   assign                    sCLR_RDY = sCLR_RDY_int;
+   assign                    dCLR_RDY = dCLR_RDY_int;
+
+   always @(posedge sCLK)
+     begin
+        if ( sENQ )
+          fifoMem[sEnqPtr[indxWidth-1:0]] <= `BSV_ASSIGNMENT_DELAY sD_IN ;
+     end
+
+   // ----------------
+   // Enqueue side
+
+   always @(posedge sCLK or `BSV_RESET_EDGE sRST)
+     begin
+        if (sRST == `BSV_RESET_VALUE)
+          begin
+             sEnqPtr     <= `BSV_ASSIGNMENT_DELAY {(indxWidth +1 ) {1'b0}} ;
+             sNotFullReg <= `BSV_ASSIGNMENT_DELAY 1'b0 ; // Mark as full during reset
+             sCountReg   <= `BSV_ASSIGNMENT_DELAY {(indxWidth +1 ) {1'b0}} ;
+             sSyncReg1   <= `BSV_ASSIGNMENT_DELAY {(indxWidth +1 ) {1'b0}} ;
+             sDeqPtr     <= `BSV_ASSIGNMENT_DELAY {(indxWidth +1 ) {1'b0}} ;
+          end
+        else
+          begin
+             sSyncReg1 <= `BSV_ASSIGNMENT_DELAY dDeqPtr ; // clock domain crossing
+             sDeqPtr   <= `BSV_ASSIGNMENT_DELAY sSyncReg1 ;
+
+             if (sClear)
+                begin
+                   sEnqPtr     <= `BSV_ASSIGNMENT_DELAY {(indxWidth +1 ) {1'b0}} ;
+                   sNotFullReg <= `BSV_ASSIGNMENT_DELAY 1'b0 ;
+                   sCountReg   <= `BSV_ASSIGNMENT_DELAY {(indxWidth +1 ) {1'b0}} ;
+                end
+             else if ( sENQ )
+               begin
+                  sEnqPtr     <= `BSV_ASSIGNMENT_DELAY sNextEnqPtr ;
+                  sNotFullReg <= `BSV_ASSIGNMENT_DELAY (sNextEnqPtr ^ msbset) != sDeqPtr ;
+                  sCountReg   <= `BSV_ASSIGNMENT_DELAY sNextEnqPtr - sDeqPtr ;
+               end
+             else
+               begin
+                  sNotFullReg <= `BSV_ASSIGNMENT_DELAY (sEnqPtr ^ msbset) != sDeqPtr ;
+                  sCountReg   <= `BSV_ASSIGNMENT_DELAY sEnqPtr - sDeqPtr ;
+               end
+          end
+     end
+
+   // ----------------
+   // Dequeue side
+
+   always @(posedge dCLK or `BSV_RESET_EDGE sRST)
+     begin
+        if (sRST == `BSV_RESET_VALUE)
+          begin
+             dSyncReg1 <= `BSV_ASSIGNMENT_DELAY {(indxWidth + 1) {1'b0}} ;
+             dEnqPtr   <= `BSV_ASSIGNMENT_DELAY {(indxWidth + 1) {1'b0}} ;
+          end
+        else
+          begin
+             dSyncReg1 <= `BSV_ASSIGNMENT_DELAY sEnqPtr ; // clock domain crossing
+             dEnqPtr   <= `BSV_ASSIGNMENT_DELAY dSyncReg1 ;
+          end
+     end
+
+   always @(posedge dCLK or `BSV_RESET_EDGE dRST)
+     begin
+        if (dRST == `BSV_RESET_VALUE)
+          begin
+             dDeqPtr      <= `BSV_ASSIGNMENT_DELAY {(indxWidth + 1) {1'b0}} ;
+             dNotEmptyReg <= `BSV_ASSIGNMENT_DELAY 1'b0 ; // Mark as empty to avoid dequeues until after reset
+             dCountReg    <= `BSV_ASSIGNMENT_DELAY {(indxWidth + 1) {1'b0}} ;
+          end
+        else if (dClear)
+          begin
+             dDeqPtr      <= `BSV_ASSIGNMENT_DELAY {(indxWidth + 1) {1'b0}} ;
+             dNotEmptyReg <= `BSV_ASSIGNMENT_DELAY 1'b0 ;
+             dCountReg    <= `BSV_ASSIGNMENT_DELAY {(indxWidth + 1) {1'b0}} ;
+          end
+        else if ((!dNotEmptyReg || dDEQ) && dNextNotEmpty)
+          begin
+             dDeqPtr      <= `BSV_ASSIGNMENT_DELAY dNextDeqPtr ;
+             dNotEmptyReg <= `BSV_ASSIGNMENT_DELAY 1'b1 ;
+             dCountReg    <= `BSV_ASSIGNMENT_DELAY dNextCnt ;
+          end
+        else if (dDEQ && !dNextNotEmpty)
+          begin
+             dNotEmptyReg <= `BSV_ASSIGNMENT_DELAY 1'b0 ;
+             dCountReg    <= `BSV_ASSIGNMENT_DELAY {(indxWidth + 1) {1'b0}} ;
+          end
+        else
+          begin
+             dCountReg    <= `BSV_ASSIGNMENT_DELAY dNextCnt ;
+          end
+     end
+
+   always @(posedge dCLK)
+     begin
+        if ((!dNotEmptyReg || dDEQ) && dNextNotEmpty)
+          dDoutReg <= `BSV_ASSIGNMENT_DELAY fifoMem[dDeqPtr[indxWidth-1:0]] ;
+     end
+
+`ifdef BSV_FAST_PRIM_CHECKS
+   always @(posedge sCLK)
+     begin
+        if ( sENQ && ! sNotFullReg ) $display ("Warning: SyncFIFOLevel: %m -- Enqueing to a full fifo");
+     end
+   always @(posedge dCLK)
+     begin
+        if ( dDEQ && ! dNotEmptyReg ) $display ("Warning: SyncFIFOLevel: %m -- Dequeuing from empty fifo");
+     end
+`endif
+
+endmodule // SyncFIFOLevel
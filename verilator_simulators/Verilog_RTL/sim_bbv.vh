@@ -0,0 +1,20 @@
+
+`ifndef __SIM_BBV_VH__
+`define __SIM_BBV_VH__
+
+// Basic-block vectors (src_C/sim_bbv.h): included at the end of
+// mkTop_HW_Side by Resources/sed_bbv.txt, which also connects the SoC's
+// tandem-verification output to soc_top$tv_verifier_info_get_get.  Each
+// message the SoC delivers ({num_bytes, vec_bytes}, byte 0 in the low bits
+// of vec_bytes) is passed to the collector.
+import "DPI-C" function void c_tv_bbv_put(input int unsigned num_bytes, input bit [575:0] vec_bytes);
+
+  always@(posedge CLK)
+  begin
+    if (sysRst_Ifc$OUT_RST != `BSV_RESET_VALUE)
+      if (soc_top$EN_tv_verifier_info_get_get)
+	c_tv_bbv_put(soc_top$tv_verifier_info_get_get[607 : 576],
+		     soc_top$tv_verifier_info_get_get[575 : 0]);
+  end
+
+`endif
@@ -0,0 +1,16 @@
+
+`ifndef __SIM_INSTRET_VH__
+`define __SIM_INSTRET_VH__
+
+// Retired-instruction count, reported by sim_main at the end of
+// simulation: included at the end of mkTop_HW_Side by
+// Resources/sed_script.txt.  INSTRET_REG is the core's minstret register,
+// as a hierarchical name (procs/<proc>/Include.mk); without it, or with
+// HIER=1 (where the core is a separate block), nothing is reported.
+`ifdef INSTRET_REG
+import "DPI-C" function void c_set_instret(input longint unsigned instret);
+
+  final c_set_instret(`INSTRET_REG);
+`endif
+
+`endif
@@ -0,0 +1,10 @@
+
+`ifndef __SIM_REGFILE_VH__
+`define __SIM_REGFILE_VH__
+
+// Sparse RegFileLoad storage (src_C/sim_regfile.cpp)
+import "DPI-C" function int unsigned c_regfile_open(input string filename, input int unsigned binary, input int unsigned data_width, input longint unsigned lo, input longint unsigned hi);
+import "DPI-C" function longint unsigned c_regfile_read(input int unsigned handle, input longint unsigned index, input int unsigned word, input int unsigned dummy);
+import "DPI-C" function void c_regfile_write(input int unsigned handle, input longint unsigned index, input int unsigned word, input longint unsigned data);
+
+`endif
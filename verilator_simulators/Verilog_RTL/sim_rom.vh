@@ -0,0 +1,9 @@
+
+`ifndef __SIM_ROM_VH__
+`define __SIM_ROM_VH__
+
+// Boot ROM and flash contents (src_C/C_Imported_Functions.c)
+import "DPI-C" function int unsigned c_rom_load(input int unsigned rom, input string filename, input longint unsigned offset);
+import "DPI-C" pure function longint unsigned c_rom_read(input int unsigned rom, input longint unsigned offset);
+
+`endif
@@ -0,0 +1,160 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Test of the trace decoder of ../src_C/sim_bbv.cpp: feeds it the trace of
+// a small program, with the next PC of each instruction group given as an
+// increment ("incr") or in full ("full"), and checks that both give the
+// same basic blocks.  Usage:
+//     tb_bbv incr|full +bbv +bbv_out=<prefix>
+// Prints PASS or FAIL, and exits non-zero on FAIL.
+//
+// The program: a loop of four instructions (one compressed) from
+// 0x8000_0000, whose last one branches back LOOP_ITERS - 1 times and then
+// falls through; then an interrupt, and two instructions of the handler at
+// 0x8000_1000.  Expected: two basic blocks, the loop (with the instruction
+// after it) and the handler.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "verilated.h"
+#include "sim_bbv.h"
+
+#define LOOP_PC     0x80000000ULL
+#define HANDLER_PC  0x80001000ULL
+#define LOOP_ITERS  5
+
+// Bytes per c_tv_bbv_put () call, less than a group so that items are
+// split across messages
+#define CHUNK_BYTES  7
+
+vluint64_t n_cycles = 0;    // read by sim_bbv.cpp
+
+static bool                    full_pc;
+static std::vector <uint8_t>   trace;
+
+// ================================================================
+// Trace encoding (trace-protocol.pdf), for TV_XLEN = 64
+
+static void put_pc (uint64_t pc)
+{
+    int j;
+
+    trace.push_back (7);       // additional state
+    trace.push_back (10);      // PC
+    for (j = 0; j < 8; j++)
+	trace.push_back ((uint8_t) (pc >> (8 * j)));
+}
+
+// A group with no instruction, setting the PC (state init, interrupt)
+static void group_pc (uint64_t pc)
+{
+    trace.push_back (1);
+    put_pc (pc);
+    trace.push_back (2);
+}
+
+// A group with an instruction of len bytes at pc, followed by next_pc
+static void group_instr (uint64_t pc, unsigned len, uint64_t next_pc)
+{
+    trace.push_back (1);
+    if (len == 2) {
+	trace.push_back (16);
+	trace.push_back (0x01);    // c.nop
+	trace.push_back (0x00);
+    }
+    else {
+	trace.push_back (17);
+	trace.push_back (0x13);    // nop
+	trace.push_back (0x00);
+	trace.push_back (0x00);
+	trace.push_back (0x00);
+    }
+    if (full_pc || (next_pc != pc + len))
+	put_pc (next_pc);
+    else
+	trace.push_back (3);       // incr_pc
+    trace.push_back (2);
+}
+
+// ================================================================
+
+static std::string read_file (const std::string &name)
+{
+    std::string  s;
+    char         buf [256];
+    FILE        *fp = fopen (name.c_str (), "r");
+
+    if (fp == NULL)
+	return "";
+    while (fgets (buf, sizeof (buf), fp) != NULL)
+	s += buf;
+    fclose (fp);
+    return s;
+}
+
+static bool check (const char *what, const std::string &got, const std::string &expected)
+{
+    if (got == expected)
+	return true;
+    fprintf (stderr, "ERROR: %s:\n  got:\n%s  expected:\n%s", what, got.c_str (), expected.c_str ());
+    return false;
+}
+
+int main (int argc, char **argv)
+{
+    const char  *prefix;
+    svBitVecVal  words [(CHUNK_BYTES + 3) / 4];
+    size_t       pos, j;
+    unsigned     n, iter;
+    char         expected [256];
+    bool         ok;
+
+    if ((argc < 2) || ((strcmp (argv [1], "incr") != 0) && (strcmp (argv [1], "full") != 0))) {
+	fprintf (stderr, "Usage: %s incr|full +bbv +bbv_out=<prefix>\n", argv [0]);
+	return 1;
+    }
+    full_pc = (strcmp (argv [1], "full") == 0);
+    Verilated::commandArgs (argc, argv);
+    prefix = Verilated::commandArgsPlusMatch ("bbv_out=");
+    if ((prefix == NULL) || (prefix [0] != '+')) {
+	fprintf (stderr, "ERROR: no +bbv_out=<prefix>\n");
+	return 1;
+    }
+    prefix += strlen ("+bbv_out=");
+
+    group_pc (LOOP_PC);
+    for (iter = 0; iter < LOOP_ITERS; iter++) {
+	group_instr (LOOP_PC,      4, LOOP_PC + 4);
+	group_instr (LOOP_PC + 4,  2, LOOP_PC + 6);
+	group_instr (LOOP_PC + 6,  4, LOOP_PC + 10);
+	group_instr (LOOP_PC + 10, 4, (iter + 1 < LOOP_ITERS) ? LOOP_PC : LOOP_PC + 14);
+    }
+    group_instr (LOOP_PC + 14, 4, LOOP_PC + 18);
+    group_pc (HANDLER_PC);
+    group_instr (HANDLER_PC,     4, HANDLER_PC + 4);
+    group_instr (HANDLER_PC + 4, 4, HANDLER_PC + 8);
+
+    bbv_init ();
+    for (pos = 0; pos < trace.size (); pos += n) {
+	n = (trace.size () - pos < CHUNK_BYTES) ? trace.size () - pos : CHUNK_BYTES;
+	memset (words, 0, sizeof (words));
+	for (j = 0; j < n; j++)
+	    words [j / 4] |= (svBitVecVal) trace [pos + j] << (8 * (j % 4));
+	n_cycles += 10;
+	c_tv_bbv_put (n, words);
+    }
+    bbv_final ();
+
+    snprintf (expected, sizeof (expected), "T:1:%u :2:2 \n", 4 * LOOP_ITERS + 1);
+    ok = check ("basic-block vector", read_file (std::string (prefix) + ".bb"), expected);
+    snprintf (expected, sizeof (expected), "# id start_pc\n1 0x%llx\n2 0x%llx\n", LOOP_PC, HANDLER_PC);
+    ok = check ("basic-block map", read_file (std::string (prefix) + ".bbmap"), expected) && ok;
+
+    printf ("%s: %s-PC encoding\n", ok ? "PASS" : "FAIL", full_pc ? "full" : "incremental");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Equivalence test: Verilog_RTL/Fast/BRAM2.v against Verilog_RTL/BRAM2.v
+// (renamed BRAM2_orig by the Makefile), both ports on one clock.  See
+// tb_common.vh.
+
+`define TB_NAME "BRAM2"
+`include "tb_common.vh"
+
+module cmp_BRAM2 (CLK, RST, done, errors);
+   parameter PIPELINED  = 0;
+   parameter ADDR_WIDTH = 5;
+   parameter DATA_WIDTH = 64;
+   parameter MEMSIZE    = 32;
+
+   input         CLK, RST, done;
+   output [31:0] errors;
+
+   reg                     ena, wea, enb, web;
+   reg  [ADDR_WIDTH-1:0]   addra, addrb;
+   reg  [DATA_WIDTH-1:0]   dia, dib;
+
+   wire [DATA_WIDTH-1:0]   o_doa, o_dob, f_doa, f_dob;
+
+   // Outputs are compared once they hold a written entry (the original
+   // starts its RAM and output registers as 'hAAAA...)
+   reg  [MEMSIZE-1:0]      written;
+   reg  [2:0]              a_valid, b_valid;
+
+   BRAM2_orig #(.PIPELINED(PIPELINED), .ADDR_WIDTH(ADDR_WIDTH), .DATA_WIDTH(DATA_WIDTH), .MEMSIZE(MEMSIZE))
+     orig (.CLKA(CLK), .ENA(ena), .WEA(wea), .ADDRA(addra), .DIA(dia), .DOA(o_doa),
+           .CLKB(CLK), .ENB(enb), .WEB(web), .ADDRB(addrb), .DIB(dib), .DOB(o_dob));
+
+   BRAM2 #(.PIPELINED(PIPELINED), .ADDR_WIDTH(ADDR_WIDTH), .DATA_WIDTH(DATA_WIDTH), .MEMSIZE(MEMSIZE))
+     fast (.CLKA(CLK), .ENA(ena), .WEA(wea), .ADDRA(addra), .DIA(dia), .DOA(f_doa),
+           .CLKB(CLK), .ENB(enb), .WEB(web), .ADDRB(addrb), .DIB(dib), .DOB(f_dob));
+
+   initial
+     begin
+        written = 0;
+        a_valid = 0;
+        b_valid = 0;
+     end
+
+   // Addresses within MEMSIZE; no writes from both ports to one address
+   // in the same cycle (the result is undefined)
+   always @(negedge CLK)
+     begin : stimulus
+        reg [ADDR_WIDTH-1:0] a, b;
+        a = $urandom % MEMSIZE;
+        b = $urandom % MEMSIZE;
+        addra <= a;
+        addrb <= b;
+        dia   <= `TB_RANDOM;
+        dib   <= `TB_RANDOM;
+        ena   <= RST && `TB_CHANCE(70);
+        enb   <= RST && `TB_CHANCE(70);
+        wea   <= `TB_CHANCE(40);
+        web   <= `TB_CHANCE(40) && (a != b);
+     end
+
+   // Whether each port's output (after PIPELINED stages) holds known data
+   always @(posedge CLK)
+     begin
+        if (ena)
+          a_valid[0] <= wea || written[addra];
+        a_valid[1] <= a_valid[0];
+        if (enb)
+          b_valid[0] <= web || written[addrb];
+        b_valid[1] <= b_valid[0];
+        if (ena && wea) written[addra] <= 1'b1;
+        if (enb && web) written[addrb] <= 1'b1;
+     end
+
+   `TB_CHECKER
+   always @(posedge CLK)
+     if (RST && ! done)
+       begin
+          if (a_valid[PIPELINED ? 1 : 0]) `TB_CHECK("DOA", o_doa, f_doa)
+          if (b_valid[PIPELINED ? 1 : 0]) `TB_CHECK("DOB", o_dob, f_dob)
+       end
+endmodule
+
+module tb_BRAM2 (CLK, failed);
+   input  CLK;
+   output failed;
+
+   `TB_CONTROL
+
+   wire [31:0] e1, e2, e3;
+
+   cmp_BRAM2 #(.PIPELINED(0), .ADDR_WIDTH(5), .DATA_WIDTH(64),  .MEMSIZE(32)) c1 (.CLK(CLK), .RST(RST), .done(done), .errors(e1));
+   cmp_BRAM2 #(.PIPELINED(1), .ADDR_WIDTH(5), .DATA_WIDTH(64),  .MEMSIZE(32)) c2 (.CLK(CLK), .RST(RST), .done(done), .errors(e2));
+   cmp_BRAM2 #(.PIPELINED(1), .ADDR_WIDTH(6), .DATA_WIDTH(130), .MEMSIZE(40)) c3 (.CLK(CLK), .RST(RST), .done(done), .errors(e3));
+
+   assign n_errors = e1 + e2 + e3;
+endmodule
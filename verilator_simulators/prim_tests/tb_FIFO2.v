@@ -0,0 +1,69 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Equivalence test: Verilog_RTL/Fast/FIFO2.v against Verilog_RTL/FIFO2.v
+// (renamed FIFO2_orig by the Makefile).  See tb_common.vh.
+
+`define TB_NAME "FIFO2"
+`include "tb_common.vh"
+
+module cmp_FIFO2 (CLK, RST, done, errors);
+   parameter width   = 37;
+   parameter guarded = 1;
+
+   input         CLK, RST, done;
+   output [31:0] errors;
+
+   reg  [width - 1 : 0] d_in;
+   reg                  r_enq, r_deq, r_clr;
+   wire                 enq, deq, clr;
+
+   wire [width - 1 : 0] o_d_out, f_d_out;
+   wire                 o_full_n, o_empty_n, f_full_n, f_empty_n;
+
+   FIFO2_orig #(.width(width), .guarded(guarded))
+     orig (.CLK(CLK), .RST(RST), .D_IN(d_in), .ENQ(enq), .FULL_N(o_full_n),
+           .D_OUT(o_d_out), .DEQ(deq), .EMPTY_N(o_empty_n), .CLR(clr));
+
+   FIFO2 #(.width(width), .guarded(guarded))
+     fast (.CLK(CLK), .RST(RST), .D_IN(d_in), .ENQ(enq), .FULL_N(f_full_n),
+           .D_OUT(f_d_out), .DEQ(deq), .EMPTY_N(f_empty_n), .CLR(clr));
+
+   // Legal stimulus only: enq when not full (or, unguarded, when full
+   // and dequeuing), deq when not empty
+   assign deq = o_empty_n && r_deq;
+   assign enq = (o_full_n || (! guarded && deq)) && r_enq;
+   assign clr = r_clr;
+
+   always @(negedge CLK)
+     begin
+        d_in  <= `TB_RANDOM;
+        r_enq <= `TB_CHANCE(60);
+        r_deq <= `TB_CHANCE(50);
+        r_clr <= `TB_CHANCE(1);
+     end
+
+   `TB_CHECKER
+   always @(posedge CLK)
+     if (RST && ! done)
+       begin
+          `TB_CHECK("FULL_N",  o_full_n,  f_full_n)
+          `TB_CHECK("EMPTY_N", o_empty_n, f_empty_n)
+          if (o_empty_n)
+            `TB_CHECK("D_OUT", o_d_out, f_d_out)
+       end
+endmodule
+
+module tb_FIFO2 (CLK, failed);
+   input  CLK;
+   output failed;
+
+   `TB_CONTROL
+
+   wire [31:0] e1, e2, e3;
+
+   cmp_FIFO2 #(.width(37), .guarded(1)) c1 (.CLK(CLK), .RST(RST), .done(done), .errors(e1));
+   cmp_FIFO2 #(.width(1),  .guarded(1)) c2 (.CLK(CLK), .RST(RST), .done(done), .errors(e2));
+   cmp_FIFO2 #(.width(97), .guarded(0)) c3 (.CLK(CLK), .RST(RST), .done(done), .errors(e3));
+
+   assign n_errors = e1 + e2 + e3;
+endmodule
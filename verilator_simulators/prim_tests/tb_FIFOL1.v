@@ -0,0 +1,67 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Equivalence test: Verilog_RTL/Fast/FIFOL1.v against Verilog_RTL/FIFOL1.v
+// (renamed FIFOL1_orig by the Makefile).  See tb_common.vh.
+
+`define TB_NAME "FIFOL1"
+`include "tb_common.vh"
+
+module cmp_FIFOL1 (CLK, RST, done, errors);
+   parameter width = 37;
+
+   input         CLK, RST, done;
+   output [31:0] errors;
+
+   reg  [width - 1 : 0] d_in;
+   reg                  r_enq, r_deq, r_clr;
+   wire                 enq, deq, clr;
+
+   wire [width - 1 : 0] o_d_out, f_d_out;
+   wire                 o_full_n, o_empty_n, f_full_n, f_empty_n;
+
+   FIFOL1_orig #(.width(width))
+     orig (.CLK(CLK), .RST(RST), .D_IN(d_in), .ENQ(enq), .FULL_N(o_full_n),
+           .D_OUT(o_d_out), .DEQ(deq), .EMPTY_N(o_empty_n), .CLR(clr));
+
+   FIFOL1 #(.width(width))
+     fast (.CLK(CLK), .RST(RST), .D_IN(d_in), .ENQ(enq), .FULL_N(f_full_n),
+           .D_OUT(f_d_out), .DEQ(deq), .EMPTY_N(f_empty_n), .CLR(clr));
+
+   // Legal stimulus only: deq when not empty, enq when not full (FULL_N
+   // already includes this cycle's deq)
+   assign deq = o_empty_n && r_deq;
+   assign enq = o_full_n && r_enq;
+   assign clr = r_clr;
+
+   always @(negedge CLK)
+     begin
+        d_in  <= `TB_RANDOM;
+        r_enq <= `TB_CHANCE(60);
+        r_deq <= `TB_CHANCE(50);
+        r_clr <= `TB_CHANCE(1);
+     end
+
+   `TB_CHECKER
+   always @(posedge CLK)
+     if (RST && ! done)
+       begin
+          `TB_CHECK("FULL_N",  o_full_n,  f_full_n)
+          `TB_CHECK("EMPTY_N", o_empty_n, f_empty_n)
+          if (o_empty_n)
+            `TB_CHECK("D_OUT", o_d_out, f_d_out)
+       end
+endmodule
+
+module tb_FIFOL1 (CLK, failed);
+   input  CLK;
+   output failed;
+
+   `TB_CONTROL
+
+   wire [31:0] e1, e2;
+
+   cmp_FIFOL1 #(.width(37)) c1 (.CLK(CLK), .RST(RST), .done(done), .errors(e1));
+   cmp_FIFOL1 #(.width(1))  c2 (.CLK(CLK), .RST(RST), .done(done), .errors(e2));
+
+   assign n_errors = e1 + e2;
+endmodule
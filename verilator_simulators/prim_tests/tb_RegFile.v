@@ -0,0 +1,92 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Equivalence test: Verilog_RTL/Fast/RegFile.v against Verilog_RTL/RegFile.v
+// (renamed RegFile_orig by the Makefile).  See tb_common.vh.
+
+`define TB_NAME "RegFile"
+`include "tb_common.vh"
+
+module cmp_RegFile (CLK, RST, done, errors);
+   parameter addr_width = 6;
+   parameter data_width = 64;
+   parameter lo         = 0;
+   parameter hi         = 31;
+
+   input         CLK, RST, done;
+   output [31:0] errors;
+
+   reg  [addr_width - 1 : 0] addr_in, addr_1, addr_2, addr_3, addr_4, addr_5;
+   reg  [data_width - 1 : 0] d_in;
+   reg                       r_we;
+   wire                      we = r_we && RST;
+
+   wire [data_width - 1 : 0] o_1, o_2, o_3, o_4, o_5;
+   wire [data_width - 1 : 0] f_1, f_2, f_3, f_4, f_5;
+
+   // Entries are only compared once written (the originals start as 'hAAAA...)
+   reg  [hi : lo]            written;
+
+   RegFile_orig #(.addr_width(addr_width), .data_width(data_width), .lo(lo), .hi(hi))
+     orig (.CLK(CLK), .ADDR_IN(addr_in), .D_IN(d_in), .WE(we),
+           .ADDR_1(addr_1), .D_OUT_1(o_1), .ADDR_2(addr_2), .D_OUT_2(o_2),
+           .ADDR_3(addr_3), .D_OUT_3(o_3), .ADDR_4(addr_4), .D_OUT_4(o_4),
+           .ADDR_5(addr_5), .D_OUT_5(o_5));
+
+   RegFile #(.addr_width(addr_width), .data_width(data_width), .lo(lo), .hi(hi))
+     fast (.CLK(CLK), .ADDR_IN(addr_in), .D_IN(d_in), .WE(we),
+           .ADDR_1(addr_1), .D_OUT_1(f_1), .ADDR_2(addr_2), .D_OUT_2(f_2),
+           .ADDR_3(addr_3), .D_OUT_3(f_3), .ADDR_4(addr_4), .D_OUT_4(f_4),
+           .ADDR_5(addr_5), .D_OUT_5(f_5));
+
+   // Addresses within [lo, hi] only
+   function [addr_width - 1 : 0] rand_addr;
+      input [31:0] r;
+      begin
+         rand_addr = lo + (r % (hi - lo + 1));
+      end
+   endfunction
+
+   initial written = 0;
+
+   always @(negedge CLK)
+     begin
+        addr_in <= rand_addr ($urandom);
+        addr_1  <= rand_addr ($urandom);
+        addr_2  <= rand_addr ($urandom);
+        addr_3  <= rand_addr ($urandom);
+        addr_4  <= rand_addr ($urandom);
+        addr_5  <= rand_addr ($urandom);
+        d_in    <= `TB_RANDOM;
+        r_we    <= `TB_CHANCE(50);
+     end
+
+   `TB_CHECKER
+   always @(posedge CLK)
+     if (RST && ! done)
+       begin
+          if (written[addr_1]) `TB_CHECK("D_OUT_1", o_1, f_1)
+          if (written[addr_2]) `TB_CHECK("D_OUT_2", o_2, f_2)
+          if (written[addr_3]) `TB_CHECK("D_OUT_3", o_3, f_3)
+          if (written[addr_4]) `TB_CHECK("D_OUT_4", o_4, f_4)
+          if (written[addr_5]) `TB_CHECK("D_OUT_5", o_5, f_5)
+          if (we)
+            written[addr_in] <= 1'b1;
+       end
+endmodule
+
+module tb_RegFile (CLK, failed);
+   input  CLK;
+   output failed;
+
+   `TB_CONTROL
+
+   wire [31:0] e1, e2, e3;
+
+   // A register file, an offset range that is not a power of 2, and one
+   // entry
+   cmp_RegFile #(.addr_width(5), .data_width(64), .lo(0),  .hi(31)) c1 (.CLK(CLK), .RST(RST), .done(done), .errors(e1));
+   cmp_RegFile #(.addr_width(7), .data_width(97), .lo(20), .hi(70)) c2 (.CLK(CLK), .RST(RST), .done(done), .errors(e2));
+   cmp_RegFile #(.addr_width(3), .data_width(5),  .lo(6),  .hi(6))  c3 (.CLK(CLK), .RST(RST), .done(done), .errors(e3));
+
+   assign n_errors = e1 + e2 + e3;
+endmodule
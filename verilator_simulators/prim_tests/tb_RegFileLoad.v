@@ -0,0 +1,100 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Equivalence test: Verilog_RTL/Fast/RegFileLoad.v (sparse C++ storage)
+// against Verilog_RTL/RegFileLoad.v (renamed RegFileLoad_orig by the
+// Makefile), both loaded from regfile_load.hex.  See tb_common.vh.
+
+`define TB_NAME "RegFileLoad"
+`include "tb_common.vh"
+
+module cmp_RegFileLoad (CLK, RST, done, errors);
+   parameter addr_width = 6;
+   parameter data_width = 100;
+   parameter lo         = 0;
+   parameter hi         = 63;
+
+   // Entries loaded from the file (the others start undefined)
+   parameter file_lo    = 'h10;
+   parameter file_hi    = 'h2f;
+
+   input         CLK, RST, done;
+   output [31:0] errors;
+
+   reg  [addr_width - 1 : 0] addr_in, addr_1, addr_2, addr_3, addr_4, addr_5;
+   reg  [data_width - 1 : 0] d_in;
+   reg                       r_we;
+   wire                      we = r_we && RST;
+
+   wire [data_width - 1 : 0] o_1, o_2, o_3, o_4, o_5;
+   wire [data_width - 1 : 0] f_1, f_2, f_3, f_4, f_5;
+
+   reg  [hi : lo]            known;
+
+   RegFileLoad_orig #(.file("regfile_load.hex"), .addr_width(addr_width), .data_width(data_width),
+                      .lo(lo), .hi(hi), .binary(0))
+     orig (.CLK(CLK), .ADDR_IN(addr_in), .D_IN(d_in), .WE(we),
+           .ADDR_1(addr_1), .D_OUT_1(o_1), .ADDR_2(addr_2), .D_OUT_2(o_2),
+           .ADDR_3(addr_3), .D_OUT_3(o_3), .ADDR_4(addr_4), .D_OUT_4(o_4),
+           .ADDR_5(addr_5), .D_OUT_5(o_5));
+
+   RegFileLoad #(.file("regfile_load.hex"), .addr_width(addr_width), .data_width(data_width),
+                 .lo(lo), .hi(hi), .binary(0))
+     fast (.CLK(CLK), .ADDR_IN(addr_in), .D_IN(d_in), .WE(we),
+           .ADDR_1(addr_1), .D_OUT_1(f_1), .ADDR_2(addr_2), .D_OUT_2(f_2),
+           .ADDR_3(addr_3), .D_OUT_3(f_3), .ADDR_4(addr_4), .D_OUT_4(f_4),
+           .ADDR_5(addr_5), .D_OUT_5(f_5));
+
+   function [addr_width - 1 : 0] rand_addr;
+      input [31:0] r;
+      begin
+         rand_addr = lo + (r % (hi - lo + 1));
+      end
+   endfunction
+
+   initial
+     begin : init_known
+        integer j;
+        for (j = lo; j <= hi; j = j + 1)
+          known[j] = (j >= file_lo) && (j <= file_hi);
+     end
+
+   // Few writes, so that the loaded contents are read for a while
+   always @(negedge CLK)
+     begin
+        addr_in <= rand_addr ($urandom);
+        addr_1  <= rand_addr ($urandom);
+        addr_2  <= rand_addr ($urandom);
+        addr_3  <= rand_addr ($urandom);
+        addr_4  <= rand_addr ($urandom);
+        addr_5  <= rand_addr ($urandom);
+        d_in    <= `TB_RANDOM;
+        r_we    <= `TB_CHANCE(2);
+     end
+
+   `TB_CHECKER
+   always @(posedge CLK)
+     if (RST && ! done)
+       begin
+          if (known[addr_1]) `TB_CHECK("D_OUT_1", o_1, f_1)
+          if (known[addr_2]) `TB_CHECK("D_OUT_2", o_2, f_2)
+          if (known[addr_3]) `TB_CHECK("D_OUT_3", o_3, f_3)
+          if (known[addr_4]) `TB_CHECK("D_OUT_4", o_4, f_4)
+          if (known[addr_5]) `TB_CHECK("D_OUT_5", o_5, f_5)
+          if (we)
+            known[addr_in] <= 1'b1;
+       end
+endmodule
+
+module tb_RegFileLoad (CLK, failed);
+   input  CLK;
+   output failed;
+
+   `TB_CONTROL
+
+   wire [31:0] e1, e2;
+
+   cmp_RegFileLoad #(.addr_width(6), .data_width(100), .lo(0), .hi(63)) c1 (.CLK(CLK), .RST(RST), .done(done), .errors(e1));
+   cmp_RegFileLoad #(.addr_width(8), .data_width(100), .lo(4), .hi(50)) c2 (.CLK(CLK), .RST(RST), .done(done), .errors(e2));
+
+   assign n_errors = e1 + e2;
+endmodule
@@ -0,0 +1,78 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Equivalence test: Verilog_RTL/Fast/SizedFIFO.v against
+// Verilog_RTL/SizedFIFO.v (renamed SizedFIFO_orig by the Makefile), for
+// the depths used in the SoC (4, 8) and others.  See tb_common.vh.
+
+`define TB_NAME "SizedFIFO"
+`include "tb_common.vh"
+
+module cmp_SizedFIFO (CLK, RST, done, errors);
+   parameter p1width      = 12;
+   parameter p2depth      = 8;
+   parameter p3cntr_width = 3;
+   parameter guarded      = 1;
+   parameter enq_pct      = 60;
+
+   input         CLK, RST, done;
+   output [31:0] errors;
+
+   reg  [p1width - 1 : 0] d_in;
+   reg                    r_enq, r_deq, r_clr;
+   wire                   enq, deq, clr;
+
+   wire [p1width - 1 : 0] o_d_out, f_d_out;
+   wire                   o_full_n, o_empty_n, f_full_n, f_empty_n;
+
+   SizedFIFO_orig #(.p1width(p1width), .p2depth(p2depth), .p3cntr_width(p3cntr_width), .guarded(guarded))
+     orig (.CLK(CLK), .RST(RST), .D_IN(d_in), .ENQ(enq), .FULL_N(o_full_n),
+           .D_OUT(o_d_out), .DEQ(deq), .EMPTY_N(o_empty_n), .CLR(clr));
+
+   SizedFIFO #(.p1width(p1width), .p2depth(p2depth), .p3cntr_width(p3cntr_width), .guarded(guarded))
+     fast (.CLK(CLK), .RST(RST), .D_IN(d_in), .ENQ(enq), .FULL_N(f_full_n),
+           .D_OUT(f_d_out), .DEQ(deq), .EMPTY_N(f_empty_n), .CLR(clr));
+
+   // Legal stimulus only: enq when not full (or, unguarded, when full
+   // and dequeuing), deq when not empty
+   assign deq = o_empty_n && r_deq;
+   assign enq = (o_full_n || (! guarded && deq)) && r_enq;
+   assign clr = r_clr;
+
+   always @(negedge CLK)
+     begin
+        d_in  <= `TB_RANDOM;
+        r_enq <= `TB_CHANCE(enq_pct);
+        r_deq <= `TB_CHANCE(50);
+        r_clr <= `TB_CHANCE(1);
+     end
+
+   `TB_CHECKER
+   always @(posedge CLK)
+     if (RST && ! done)
+       begin
+          `TB_CHECK("FULL_N",  o_full_n,  f_full_n)
+          `TB_CHECK("EMPTY_N", o_empty_n, f_empty_n)
+          if (o_empty_n)
+            `TB_CHECK("D_OUT", o_d_out, f_d_out)
+       end
+endmodule
+
+module tb_SizedFIFO (CLK, failed);
+   input  CLK;
+   output failed;
+
+   `TB_CONTROL
+
+   wire [31:0] e1, e2, e3, e4, e5, e6;
+
+   // Mostly-full and mostly-empty mixes, so that both ends are exercised
+   cmp_SizedFIFO #(.p1width(12), .p2depth(8), .p3cntr_width(3), .enq_pct(60)) c1 (.CLK(CLK), .RST(RST), .done(done), .errors(e1));
+   cmp_SizedFIFO #(.p1width(9),  .p2depth(4), .p3cntr_width(2), .enq_pct(40)) c2 (.CLK(CLK), .RST(RST), .done(done), .errors(e2));
+   cmp_SizedFIFO #(.p1width(1),  .p2depth(2), .p3cntr_width(1), .enq_pct(60)) c3 (.CLK(CLK), .RST(RST), .done(done), .errors(e3));
+   cmp_SizedFIFO #(.p1width(70), .p2depth(3), .p3cntr_width(1), .enq_pct(55)) c4 (.CLK(CLK), .RST(RST), .done(done), .errors(e4));
+   cmp_SizedFIFO #(.p1width(33), .p2depth(5), .p3cntr_width(2), .enq_pct(70)) c5 (.CLK(CLK), .RST(RST), .done(done), .errors(e5));
+   cmp_SizedFIFO #(.p1width(8),  .p2depth(8), .p3cntr_width(3), .enq_pct(60),
+                   .guarded(0))                                               c6 (.CLK(CLK), .RST(RST), .done(done), .errors(e6));
+
+   assign n_errors = e1 + e2 + e3 + e4 + e5 + e6;
+endmodule
@@ -0,0 +1,100 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Equivalence test: Verilog_RTL/Fast/SyncFIFOLevel.v against
+// Verilog_RTL/SyncFIFOLevel.v (renamed SyncFIFOLevel_orig by the
+// Makefile).  The source side runs on CLK; the destination clock toggles
+// on randomly chosen falling edges of CLK, so it is slower, irregular,
+// and never has an edge at the same time as CLK.  See tb_common.vh.
+
+`define TB_NAME "SyncFIFOLevel"
+
+// Long enough for the destination side, reset on dCLK, to see a clock edge
+`define TB_RESET_CYCLES 40
+
+`include "tb_common.vh"
+
+module cmp_SyncFIFOLevel (CLK, RST, done, errors);
+   parameter dataWidth = 16;
+   parameter depth     = 8;
+   parameter indxWidth = 3;
+
+   input         CLK, RST, done;
+   output [31:0] errors;
+
+   reg                      dCLK;
+   reg  [dataWidth - 1 : 0] s_d_in;
+   reg                      r_enq, r_deq, r_sclr, r_dclr;
+   wire                     s_enq, d_deq, s_clr, d_clr;
+
+   wire                     o_sfull_n, o_dempty_n, o_sclr_rdy, o_dclr_rdy;
+   wire                     f_sfull_n, f_dempty_n, f_sclr_rdy, f_dclr_rdy;
+   wire [dataWidth - 1 : 0] o_d_out, f_d_out;
+   wire [indxWidth : 0]     o_scount, o_dcount, f_scount, f_dcount;
+
+   SyncFIFOLevel_orig #(.dataWidth(dataWidth), .depth(depth), .indxWidth(indxWidth))
+     orig (.sCLK(CLK), .sRST(RST), .dCLK(dCLK),
+           .sENQ(s_enq), .sD_IN(s_d_in), .sFULL_N(o_sfull_n),
+           .dDEQ(d_deq), .dD_OUT(o_d_out), .dEMPTY_N(o_dempty_n),
+           .dCOUNT(o_dcount), .sCOUNT(o_scount),
+           .sCLR(s_clr), .sCLR_RDY(o_sclr_rdy), .dCLR(d_clr), .dCLR_RDY(o_dclr_rdy));
+
+   SyncFIFOLevel #(.dataWidth(dataWidth), .depth(depth), .indxWidth(indxWidth))
+     fast (.sCLK(CLK), .sRST(RST), .dCLK(dCLK),
+           .sENQ(s_enq), .sD_IN(s_d_in), .sFULL_N(f_sfull_n),
+           .dDEQ(d_deq), .dD_OUT(f_d_out), .dEMPTY_N(f_dempty_n),
+           .dCOUNT(f_dcount), .sCOUNT(f_scount),
+           .sCLR(s_clr), .sCLR_RDY(f_sclr_rdy), .dCLR(d_clr), .dCLR_RDY(f_dclr_rdy));
+
+   assign s_enq = o_sfull_n && r_enq;
+   assign s_clr = o_sclr_rdy && r_sclr;
+   assign d_deq = o_dempty_n && r_deq;
+   assign d_clr = o_dclr_rdy && r_dclr;
+
+   initial dCLK = 1'b0;
+
+   // Source-side stimulus and the destination clock change on falling
+   // edges of CLK; destination-side stimulus on rising edges (never a
+   // destination clock edge)
+   always @(negedge CLK)
+     begin
+        dCLK   <= `TB_CHANCE(60) ? ! dCLK : dCLK;
+        s_d_in <= `TB_RANDOM;
+        r_enq  <= `TB_CHANCE(50);
+        r_sclr <= `TB_CHANCE(1);
+     end
+
+   always @(posedge CLK)
+     begin
+        r_deq  <= `TB_CHANCE(60);
+        r_dclr <= `TB_CHANCE(1);
+     end
+
+   // Destination-side outputs only change on dCLK, so are also compared on CLK
+   `TB_CHECKER
+   always @(posedge CLK)
+     if (RST && ! done)
+       begin
+          `TB_CHECK("sFULL_N",  o_sfull_n,  f_sfull_n)
+          `TB_CHECK("sCOUNT",   o_scount,   f_scount)
+          `TB_CHECK("sCLR_RDY", o_sclr_rdy, f_sclr_rdy)
+          `TB_CHECK("dEMPTY_N", o_dempty_n, f_dempty_n)
+          `TB_CHECK("dCOUNT",   o_dcount,   f_dcount)
+          `TB_CHECK("dCLR_RDY", o_dclr_rdy, f_dclr_rdy)
+          if (o_dempty_n)
+            `TB_CHECK("dD_OUT", o_d_out, f_d_out)
+       end
+endmodule
+
+module tb_SyncFIFOLevel (CLK, failed);
+   input  CLK;
+   output failed;
+
+   `TB_CONTROL
+
+   wire [31:0] e1, e2;
+
+   cmp_SyncFIFOLevel #(.dataWidth(16), .depth(8), .indxWidth(3)) c1 (.CLK(CLK), .RST(RST), .done(done), .errors(e1));
+   cmp_SyncFIFOLevel #(.dataWidth(3),  .depth(2), .indxWidth(1)) c2 (.CLK(CLK), .RST(RST), .done(done), .errors(e2));
+
+   assign n_errors = e1 + e2;
+endmodule
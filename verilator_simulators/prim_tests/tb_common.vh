@@ -0,0 +1,69 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Common parts of the primitive equivalence testbenches.
+//
+// Each tb_<prim>.v instantiates, in one or more cmp_<prim> modules, the
+// original primitive (Verilog_RTL/<prim>.v, renamed <prim>_orig by the
+// Makefile) and the fast one (Verilog_RTL/Fast/<prim>.v) side by side,
+// drives both with the same random legal stimulus, and compares their
+// outputs on every rising clock edge after reset (FIFO data only when
+// the FIFO is not empty).  After TB_CYCLES cycles the top module prints
+// PASS or FAIL and finishes; tb_main.cpp exits with its 'failed' output.
+
+`ifndef __TB_COMMON_VH__
+`define __TB_COMMON_VH__
+
+`ifndef TB_CYCLES
+`define TB_CYCLES 200000
+`endif
+
+// Reset is active low (BSV_RESET_VALUE 0) for the first cycles
+`ifndef TB_RESET_CYCLES
+`define TB_RESET_CYCLES 4
+`endif
+
+// True with probability pct percent
+`define TB_CHANCE(pct)  (($urandom % 100) < (pct))
+
+// 256 random bits (truncated on assignment)
+`define TB_RANDOM  {$urandom, $urandom, $urandom, $urandom, $urandom, $urandom, $urandom, $urandom}
+
+// In the top module: clock count, reset, 'done', and the verdict, from
+// the sum of the cmp_<prim> modules' errors in 'n_errors'
+`define TB_CONTROL \
+   reg  [31:0] cycle; \
+   reg         RST; \
+   reg         done; \
+   reg         failed; \
+   wire [31:0] n_errors; \
+   initial begin cycle = 0; RST = 1'b0; done = 1'b0; failed = 1'b0; end \
+   always @(posedge CLK) \
+     begin \
+        cycle <= cycle + 1; \
+        RST   <= (cycle >= `TB_RESET_CYCLES); \
+        if (cycle == `TB_CYCLES) \
+          done <= 1'b1; \
+        if (cycle == `TB_CYCLES + 2) \
+          begin \
+             failed = (n_errors != 0); \
+             $display ("%s: %0d mismatches in %0d cycles: %s", \
+                       `TB_NAME, n_errors, `TB_CYCLES, failed ? "FAIL" : "PASS"); \
+             $finish; \
+          end \
+     end
+
+// In each cmp_<prim> module: the 'errors' output, and the check itself
+`define TB_CHECKER \
+   reg [31:0] errors_r; \
+   initial errors_r = 0; \
+   assign errors = errors_r;
+
+`define TB_CHECK(name, orig_val, fast_val) \
+   if ((orig_val) != (fast_val)) \
+     begin \
+        errors_r = errors_r + 1; \
+        if (errors_r <= 10) \
+          $display ("%m: %0t: %s: orig %h, fast %h", $time, name, orig_val, fast_val); \
+     end
+
+`endif
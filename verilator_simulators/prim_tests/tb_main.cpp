@@ -0,0 +1,31 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Driver for the primitive equivalence testbenches (tb_<prim>.v): toggles
+// CLK until the testbench calls $finish, and exits with the testbench's
+// 'failed' output.
+
+#include <stdio.h>
+
+#include "verilated.h"
+#include "Vtb.h"
+
+int main (int argc, char **argv)
+{
+    int status;
+
+    Verilated::commandArgs (argc, argv);
+
+    Vtb *tb = new Vtb;
+
+    tb->CLK = 0;
+    tb->eval ();
+    while (! Verilated::gotFinish ()) {
+	tb->CLK = ! tb->CLK;
+	tb->eval ();
+    }
+    tb->final ();
+
+    status = tb->failed ? 1 : 0;
+    delete tb;
+    return status;
+}
@@ -5,3 +5,6 @@ ISA       = ACIMU
 PROCESSOR = Piccolo
 PROCESSOR_RTL = $(REPO)/bluespec-processors/P1/$(PROCESSOR)/src_SSITH_P1/Verilog_RTL
 TOPNAME   = mkP1_Core
+
+# The core's minstret (Verilog_RTL/sim_instret.vh), as seen from mkTop_HW_Side
+INSTRET_REG = soc_top.core.core.cpu.csr_regfile.rg_minstret
@@ -0,0 +1,33 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// ================================================================
+// WFI fast-forward (src_C/sim_fast_forward.cpp): the registers holding
+// minstret, mcycle, mtime, mtimecmp and the CPU state, as VPI names below
+// the SoC's 'core' instance (the processor's top, renamed mkP_Core).  They
+// must be made visible to VPI by fast_forward.vlt in this directory.  If
+// the processor's RTL changes, the names can be overridden at run time with
+// +ff_minstret=..., +ff_mcycle=..., +ff_mtime=..., +ff_mtimecmp=...,
+// +ff_wfi_state=... (and the WFI value with +ff_wfi_paused=<n>)
+
+// CPU's CSR register file
+#define FF_MINSTRET  "core.core.cpu.csr_regfile.rg_minstret"
+#define FF_MCYCLE    "core.core.cpu.csr_regfile.rg_mcycle"
+
+// Memory-mapped timer (the CLINT's mtime and mtimecmp)
+#define FF_MTIME     "core.core.near_mem_io.crg_time"
+#define FF_MTIMECMP  "core.core.near_mem_io.crg_timecmp"
+
+// CPU state register, and its value while the core is paused in WFI: the
+// encoding of CPU_WFI_PAUSED in CPU_State (src_Core/CPU/CPU.bsv, built with
+// INCLUDE_GDB_CONTROL), i.e. in order
+//     CPU_RESET1, CPU_RESET2, CPU_GDB_PAUSING, CPU_DEBUG_MODE,
+//     CPU_RUNNING, CPU_WFI_PAUSED
+// Check it against the processor's CPU.bsv if that changes; a wrong value
+// only stops skips (ff_final () then reports quiet periods outside WFI).
+#define FF_WFI_STATE   "core.core.cpu.rg_state"
+#define FF_WFI_PAUSED  5
+
+// Clock cycles per increment of mtime
+#define FF_CYCLES_PER_TICK  1
+
+// ================================================================
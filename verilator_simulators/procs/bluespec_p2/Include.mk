@@ -5,3 +5,6 @@ ISA       = ACDFIMSU
 PROCESSOR = Flute
 PROCESSOR_RTL = $(REPO)/bluespec-processors/P2/$(PROCESSOR)/src_SSITH_P2/Verilog_RTL
 TOPNAME   = mkP2_Core
+
+# The core's minstret (Verilog_RTL/sim_instret.vh), as seen from mkTop_HW_Side
+INSTRET_REG = soc_top.core.core.cpu.csr_regfile.rg_minstret
@@ -0,0 +1,152 @@
+#!/usr/bin/python3
+
+# Copyright (c) 2019 Bluespec, Inc.
+# See LICENSE for license details
+
+usage_line = (
+    "  Usage:\n"
+    "    $ <this_prog>    <log_file> ...\n"
+    "\n"
+    "  Reads the hardware performance-monitor lines printed by programs using\n"
+    "  Tests/c/lib/hpm.h (e.g. Tests/c/hpmprof), from simulation logs or FPGA\n"
+    "  console captures:\n"
+    "      HPM-COUNTERS <n>\n"
+    "      HPM-EVENT <name> selector=0x<sel> accepted=<0|1> probe=<count>\n"
+    "      HPM <region> cycles=<n> instret=<n> <event>=<n> ...\n"
+    "  and prints, per log:\n"
+    "    - the counters and events the processor implements\n"
+    "    - per region: IPC, cache and TLB misses per 1000 instructions, branch\n"
+    "      and jump-target misprediction rates, and the share of cycles\n"
+    "      spent in each kind of stall.\n"
+    "  A region reported several times (one line per group of events, when there\n"
+    "  are fewer counters than events) is merged; events never counted are shown\n"
+    "  as '-'.  Counts from different runs of a region are scaled to the cycles\n"
+    "  of its first line.\n"
+    "\n"
+    "  Example:\n"
+    "      $ <this_prog>  Logs/hpmprof.log\n"
+)
+
+import sys
+import re
+
+# ================================================================
+# Breakdowns: (label, numerator events, denominator, scale)
+# The denominator is an event name, or 'instret' or 'cycles'.
+
+miss_rows = [("I$ misses / kinstr",        ["icache_miss"],       "instret", 1000),
+             ("D$ misses / kinstr",        ["dcache_miss"],       "instret", 1000),
+             ("D$ misses / 100 ld+st",     ["dcache_miss"],       "load+store", 100),
+             ("ITLB misses / kinstr",      ["itlb_miss"],         "instret", 1000),
+             ("DTLB misses / kinstr",      ["dtlb_miss"],         "instret", 1000)]
+
+branch_rows = [("branch mispredict %",     ["branch_mispredict"], "branch", 100),
+               ("target mispredict / kinstr", ["target_mispredict"], "instret", 1000)]
+
+stall_events = ["load_use_interlock", "long_latency_interlock", "csr_interlock",
+                "icache_blocked", "dcache_blocked", "muldiv_interlock", "fp_interlock"]
+
+# ================================================================
+
+def main (argv = None):
+    if ((len (argv) <= 1) or
+        (argv [1] == '-h') or (argv [1] == '--help')):
+        sys.stdout.write (usage_line)
+        return 0
+
+    status = 0
+    for path in argv [1:]:
+        try:
+            with open (path, 'r', errors = 'replace') as fd:
+                text = fd.read ()
+        except OSError:
+            sys.stderr.write ("ERROR: cannot read {0}\n".format (path))
+            status = 1
+            continue
+        sys.stdout.write ("================ {0}\n".format (path))
+        report (text)
+    return status
+
+# ================================================================
+
+re_counters = re.compile (r"^HPM-COUNTERS (\d+)", re.MULTILINE)
+re_event    = re.compile (r"^HPM-EVENT (\S+) selector=(0x[0-9a-fA-F]+) accepted=(\d) probe=(\d+)", re.MULTILINE)
+re_region   = re.compile (r"^HPM (\S+) (.*)$", re.MULTILINE)
+re_field    = re.compile (r"(\S+)=(\d+)")
+
+def report (text):
+    m = re_counters.search (text)
+    if m:
+        sys.stdout.write ("HPM counters: {0}\n".format (m.group (1)))
+    events = re_event.findall (text)
+    if events:
+        accepted = [name for (name, sel, acc, probe) in events if acc == '1']
+        counting = [name for (name, sel, acc, probe) in events if acc == '1' and int (probe) > 0]
+        sys.stdout.write ("Events accepted: {0}\n".format (" ".join (accepted) if accepted else "none"))
+        sys.stdout.write ("Events counting in the probe: {0}\n".format (" ".join (counting) if counting else "none"))
+
+    # Merge the lines of each region, in order of first appearance
+    regions = []
+    by_name = {}
+    for (name, rest) in re_region.findall (text):
+        fields = dict ((k, int (v)) for (k, v) in re_field.findall (rest))
+        if 'cycles' not in fields or 'instret' not in fields:
+            continue
+        if name not in by_name:
+            by_name [name] = {'cycles': fields ['cycles'], 'instret': fields ['instret']}
+            regions.append (name)
+        entry = by_name [name]
+        scale = float (entry ['cycles']) / fields ['cycles'] if fields ['cycles'] else 1.0
+        for (k, v) in fields.items ():
+            if k not in ('cycles', 'instret') and k not in entry:
+                entry [k] = v * scale
+
+    if not regions:
+        sys.stdout.write ("No HPM region lines\n")
+        return
+
+    rows = [("cycles",  lambda e: fmt_count (e ['cycles'])),
+            ("instret", lambda e: fmt_count (e ['instret'])),
+            ("IPC",     lambda e: fmt_ratio (e ['instret'], e ['cycles'], 1))]
+    for (label, nums, den, scale) in miss_rows + branch_rows:
+        rows.append ((label, make_ratio (nums, den, scale)))
+    rows.append (("stall cycles %", make_ratio (stall_events, "cycles", 100)))
+    for ev in stall_events:
+        rows.append (("  " + ev + " %", make_ratio ([ev], "cycles", 100)))
+
+    width = max (12, max (len (r) for r in regions))
+    sys.stdout.write ("{0:<28}".format ("") + "".join (" {0:>{1}}".format (r, width) for r in regions) + "\n")
+    for (label, fn) in rows:
+        sys.stdout.write ("{0:<28}".format (label) +
+                          "".join (" {0:>{1}}".format (fn (by_name [r]), width) for r in regions) + "\n")
+
+# ================================================================
+# Help functions
+
+def make_ratio (nums, den, scale):
+    def fn (entry):
+        if not any (n in entry for n in nums):
+            return "-"
+        num = sum (entry.get (n, 0) for n in nums)
+        if den in entry:
+            d = entry [den]
+        elif "+" in den and all (x in entry for x in den.split ("+")):
+            d = sum (entry [x] for x in den.split ("+"))
+        else:
+            return "-"
+        return fmt_ratio (num, d, scale)
+    return fn
+
+def fmt_ratio (num, den, scale):
+    if not den:
+        return "-"
+    return "{0:.3f}".format (scale * float (num) / den)
+
+def fmt_count (x):
+    return "{0:.0f}".format (x)
+
+# ================================================================
+# For non-interactive invocations, call main() and use its return value
+# as the exit code.
+if __name__ == '__main__':
+  sys.exit (main (sys.argv))
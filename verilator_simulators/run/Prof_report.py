@@ -0,0 +1,343 @@
+#!/usr/bin/python3
+
+# Copyright (c) 2019 Bluespec, Inc.
+# See LICENSE for license details
+
+usage_line = (
+    "  Usage:\n"
+    "    $ <this_prog>    <opt flags>  <profile_file>  <out_dir>\n"
+    "\n"
+    "  Attributes the evaluation time of a verilated simulator to the RTL\n"
+    "  modules and instances it was spent in.  The simulator must have been built\n"
+    "  by \"make simulator PROC=<proc> PROF=1\" (Verilator's --prof-cfuncs, with\n"
+    "  module inlining off), so that each C++ function of the model evaluates\n"
+    "  statements of one instance, and is named after that instance and after\n"
+    "  the source file (i.e. the module) and line of its first statement.\n"
+    "\n"
+    "  <profile_file> is either a gprof flat profile (\"gprof -b <exe> gmon.out\")\n"
+    "  or a perf report (\"perf report --stdio --no-children --sort symbol\"),\n"
+    "  with demangled symbols (the default for both).\n"
+    "\n"
+    "  Prints, and saves in <out_dir>/report.txt:\n"
+    "    - the share of time in the model, in Verilator's scheduling and\n"
+    "      tracing code, and elsewhere (DPI-C functions, sim_main, libc);\n"
+    "    - the modules, ranked by the time spent in their statements;\n"
+    "    - the instances, ranked by the time spent in them and their\n"
+    "      sub-instances (and the time in their own statements);\n"
+    "    - the hottest source lines.\n"
+    "  Writes a flame graph of the instance hierarchy to <out_dir>/flame.svg,\n"
+    "  and its stacks to <out_dir>/flame.folded (the input format of\n"
+    "  flamegraph.pl and speedscope).\n"
+    "\n"
+    "  <opt flags> may be any of the following:\n"
+    "      --top=<n>             Rows per table (default: {0})\n"
+    "      --depth=<n>           Deepest instance level in the instance table (default: {1})\n"
+    "      --title=<text>        Title of the report and of the flame graph\n"
+    "\n"
+    "  Example:\n"
+    "      $ <this_prog>  --title=bluespec_p2  Logs/prof/bluespec_p2/profile.txt  Logs/prof/bluespec_p2\n"
+)
+
+import sys
+import os
+import re
+import zlib
+from xml.sax.saxutils import escape
+
+from Run_regression import extract_flags
+
+top_default   = 25
+depth_default = 6
+
+# ================================================================
+
+def main (argv = None):
+    (flags, argv) = extract_flags (argv)
+    if ((len (argv) <= 1) or
+        (argv [1] == '-h') or (argv [1] == '--help') or
+        (len (argv) < 3)):
+
+        sys.stdout.write (usage_line.format (top_default, depth_default))
+        return 0
+
+    try:
+        with open (argv [1], 'r', errors = 'replace') as fd:
+            text = fd.read ()
+    except OSError:
+        sys.stderr.write ("ERROR: cannot read {0}\n".format (argv [1]))
+        return 1
+    out_dir = argv [2]
+    if not os.path.isdir (out_dir):
+        os.makedirs (out_dir)
+
+    top   = int (flags.get ('top', top_default))
+    depth = int (flags.get ('depth', depth_default))
+    title = flags.get ('title', os.path.basename (os.path.abspath (out_dir)))
+
+    (samples, unit) = parse_gprof (text)
+    if not samples:
+        (samples, unit) = parse_perf (text)
+    if not samples:
+        sys.stderr.write ("ERROR: {0} is neither a gprof flat profile nor a perf report\n"
+                          .format (argv [1]))
+        return 1
+
+    entries = [classify (name, value) for (name, value) in samples]
+    total   = sum (e ['value'] for e in entries)
+    if total <= 0:
+        sys.stderr.write ("ERROR: no time recorded in {0}\n".format (argv [1]))
+        return 1
+    n_model = len ([e for e in entries if e ['kind'] == "model"])
+    if n_model == 0:
+        sys.stderr.write ("WARNING: no --prof-cfuncs functions found; was the simulator built with PROF=1?\n")
+
+    report_path = os.path.join (out_dir, "report.txt")
+    with open (report_path, 'w') as fd:
+        def out (s):
+            sys.stdout.write (s)
+            fd.write (s)
+        report (out, entries, total, unit, title, top, depth)
+
+    stacks = [(e ['stack'], e ['value']) for e in entries if e ['value'] > 0]
+    folded_path = os.path.join (out_dir, "flame.folded")
+    with open (folded_path, 'w') as fd:
+        scale = 1e6 if unit == "s" else 1e4    # microseconds, or 0.0001%
+        for (stack, value) in stacks:
+            fd.write ("{0} {1}\n".format (";".join (stack), int (round (value * scale))))
+    svg_path = os.path.join (out_dir, "flame.svg")
+    write_flame_svg (svg_path, stacks, unit, "Evaluation time by instance: " + title)
+
+    sys.stdout.write ("Report saved in: {0}\n".format (report_path))
+    sys.stdout.write ("Flame graph saved in: {0} (stacks in {1})\n".format (svg_path, folded_path))
+    return 0
+
+# ================================================================
+# Profile parsers: return ([(demangled function name, value)], unit),
+# where unit is "s" (seconds, gprof) or "%" (share of samples, perf)
+
+# % time, cumulative s, self s, [calls, self ms/call, total ms/call,] name
+re_gprof = re.compile (r"^\s*([\d.]+)\s+([\d.]+)\s+([\d.]+)\s+(?:\d+\s+[\d.]+\s+[\d.]+\s+)?(\S.*?)\s*$")
+
+def parse_gprof (text):
+    samples = []
+    in_flat = False
+    for line in text.splitlines ():
+        if line.startswith ("Flat profile"):
+            in_flat = True
+            continue
+        if not in_flat:
+            continue
+        if line.startswith ("\f") or line.startswith ("Call graph") or line.startswith ("\t\t     Call graph"):
+            break
+        m = re_gprof.match (line)
+        if m:
+            samples.append ((m.group (4), float (m.group (3))))
+    return (samples, "s")
+
+# overhead, [command, shared object,] [.] or [k], symbol
+re_perf = re.compile (r"^\s*([\d.]+)%\s.*?\[[.kgHu]\]\s+(\S.*?)\s*$")
+
+def parse_perf (text):
+    samples = []
+    for line in text.splitlines ():
+        if line.startswith ("#"):
+            continue
+        m = re_perf.match (line)
+        if m:
+            samples.append ((m.group (2), float (m.group (1))))
+    return (samples, "%")
+
+# ================================================================
+# Classify one function:
+#   model:   _<kind>__<scope>__<n>__PROF__<file>__l<line>, where <scope> is
+#            the instance path with '.' replaced by '__' (and "TOP." dropped)
+#   runtime: other methods of the model's classes (V<top>, V<top>_<module>,
+#            V<top>__Syms), e.g. _eval, _change_request, trace functions
+#   other:   everything else
+
+re_prof_cfunc = re.compile (r"^_([A-Za-z]+)__(.*?)(?:__(\d+))?__PROF__(\w+?)__l(\d+)$")
+
+def classify (name, value):
+    func   = name.split ("(") [0].strip ()
+    method = func.split ("::") [-1]
+    klass  = func.split ("::") [-2] if "::" in func else ""
+
+    m = re_prof_cfunc.match (method)
+    if m:
+        scope = [x for x in m.group (2).split ("__") if x]
+        if scope and scope [0] == "TOP":
+            scope = scope [1:]
+        if not scope:
+            scope = ["TOP"]
+        module = m.group (4)
+        line   = int (m.group (5))
+        return {'kind':   "model",
+                'value':  value,
+                'scope':  scope,
+                'module': module,
+                'line':   line,
+                'stack':  scope + ["{0}:{1}".format (module, line)]}
+
+    if klass.startswith ("V") and method.startswith (("_", "trace", "eval", "final")):
+        label = "tracing" if "trace" in method.lower () else "scheduling"
+        return {'kind': "runtime", 'value': value, 'label': label,
+                'stack': ["(verilator " + label + ")", method]}
+
+    return {'kind': "other", 'value': value, 'label': func,
+            'stack': ["(other)", func]}
+
+# ================================================================
+
+def report (out, entries, total, unit, title, top, depth):
+    def fmt (value):
+        pct = 100.0 * value / total
+        if unit == "s":
+            return "{0:>10.3f} {1:>7.2f}%".format (value, pct)
+        return "{0:>10} {1:>7.2f}%".format ("-", pct)
+
+    hdr_value = "{0:>10} {1:>8}".format ("seconds", "share")
+
+    out ("================ {0}\n".format (title))
+    out ("Total: {0}\n".format ("{0:.3f} s".format (total) if unit == "s"
+                                else "100% of samples"))
+    out ("\n")
+
+    # ----------------
+    # Where the time goes, by kind
+
+    by_kind = {}
+    for e in entries:
+        key = "model" if e ['kind'] == "model" else e ['label'] if e ['kind'] == "runtime" else "other"
+        by_kind [key] = by_kind.get (key, 0) + e ['value']
+    labels = {"model":      "RTL model (statements)",
+              "scheduling": "Verilator scheduling",
+              "tracing":    "Verilator tracing",
+              "other":      "Other (DPI-C, sim_main, libc)"}
+    out ("{0:<40} {1}\n".format ("Part", hdr_value))
+    for key in ("model", "scheduling", "tracing", "other"):
+        if key in by_kind:
+            out ("{0:<40} {1}\n".format (labels [key], fmt (by_kind [key])))
+    out ("\n")
+
+    model = [e for e in entries if e ['kind'] == "model"]
+
+    # ----------------
+    # By module (source file)
+
+    by_module = {}
+    for e in model:
+        (value, funcs, insts) = by_module.get (e ['module'], (0, 0, set ()))
+        insts.add (".".join (e ['scope']))
+        by_module [e ['module']] = (value + e ['value'], funcs + 1, insts)
+    out ("{0:<40} {1} {2:>6} {3:>6}\n".format ("Module", hdr_value, "funcs", "insts"))
+    for (module, (value, funcs, insts)) in ranked (by_module, lambda v: v [0], top):
+        out ("{0:<40} {1} {2:>6} {3:>6}\n".format (module, fmt (value), funcs, len (insts)))
+    out ("\n")
+
+    # ----------------
+    # By instance: inclusive (with sub-instances) and self
+
+    inclusive = {}
+    own       = {}
+    for e in model:
+        path = tuple (e ['scope'])
+        own [path] = own.get (path, 0) + e ['value']
+        for j in range (1, len (path) + 1):
+            if j <= depth:
+                inclusive [path [:j]] = inclusive.get (path [:j], 0) + e ['value']
+    out ("{0:<60} {1} {2:>8}\n".format ("Instance (with sub-instances)", hdr_value, "self"))
+    for (path, value) in ranked (inclusive, lambda v: v, top):
+        self_pct = 100.0 * own.get (path, 0) / total
+        out ("{0:<60} {1} {2:>7.2f}%\n".format (".".join (path), fmt (value), self_pct))
+    out ("\n")
+
+    # ----------------
+    # Hottest source lines
+
+    by_line = {}
+    for e in model:
+        key = ("{0}:{1}".format (e ['module'], e ['line']), ".".join (e ['scope']))
+        by_line [key] = by_line.get (key, 0) + e ['value']
+    out ("{0:<32} {1:<40} {2}\n".format ("Line", "Instance", hdr_value))
+    for ((line, inst), value) in ranked (by_line, lambda v: v, top):
+        out ("{0:<32} {1:<40} {2}\n".format (line, inst, fmt (value)))
+
+def ranked (d, fn_value, top):
+    return sorted (d.items (), key = lambda kv: (- fn_value (kv [1]), kv [0])) [:top]
+
+# ================================================================
+# Flame graph: the instance hierarchy, each frame as wide as the time spent
+# in it and below it; the leaves are source lines.
+
+svg_width   = 1200
+frame_h     = 16
+font_size   = 11
+char_w      = 6.5
+min_width   = 0.5
+
+def write_flame_svg (path, stacks, unit, title):
+    root = {'name': "all", 'value': 0.0, 'children': {}}
+    for (stack, value) in stacks:
+        node = root
+        node ['value'] += value
+        for name in stack:
+            node = node ['children'].setdefault (name, {'name': name, 'value': 0.0, 'children': {}})
+            node ['value'] += value
+
+    def max_depth (node):
+        return 1 + max ([max_depth (c) for c in node ['children'].values ()] + [0])
+
+    n_levels = max_depth (root)
+    height   = (n_levels + 2) * frame_h + 10
+    total    = root ['value']
+    rects    = []
+
+    def layout (node, x, level):
+        width = svg_width * node ['value'] / total
+        if width < min_width:
+            return
+        y   = height - 10 - (level + 1) * frame_h
+        pct = 100.0 * node ['value'] / total
+        if unit == "s":
+            tip = "{0} ({1:.3f} s, {2:.2f}%)".format (node ['name'], node ['value'], pct)
+        else:
+            tip = "{0} ({1:.2f}%)".format (node ['name'], pct)
+        label = node ['name']
+        n_chars = int ((width - 4) / char_w)
+        if n_chars < 3:
+            label = ""
+        elif len (label) > n_chars:
+            label = label [:n_chars - 2] + ".."
+        rects.append ('<g><title>{0}</title><rect x="{1:.1f}" y="{2}" width="{3:.1f}" height="{4}" '
+                      'fill="{5}" rx="2" ry="2"/><text x="{6:.1f}" y="{7}">{8}</text></g>\n'
+                      .format (escape (tip), x, y, width, frame_h - 1, frame_color (node ['name']),
+                               x + 3, y + frame_h - 4, escape (label)))
+        for child in sorted (node ['children'].values (), key = lambda c: c ['name']):
+            layout (child, x, level + 1)
+            x = x + svg_width * child ['value'] / total
+
+    layout (root, 0.0, 0)
+
+    with open (path, 'w') as fd:
+        fd.write ('<?xml version="1.0" standalone="no"?>\n')
+        fd.write ('<svg version="1.1" width="{0}" height="{1}" xmlns="http://www.w3.org/2000/svg">\n'
+                  .format (svg_width, height))
+        fd.write ('<style>text {{ font-family: monospace; font-size: {0}px; fill: black; }}</style>\n'
+                  .format (font_size))
+        fd.write ('<rect x="0" y="0" width="100%" height="100%" fill="#f8f8f0"/>\n')
+        fd.write ('<text x="{0}" y="{1}" text-anchor="middle">{2}</text>\n'
+                  .format (svg_width // 2, frame_h, escape (title)))
+        for r in rects:
+            fd.write (r)
+        fd.write ('</svg>\n')
+
+# Warm colours, fixed per name so that graphs of different runs compare
+def frame_color (name):
+    h = zlib.crc32 (name.encode ('utf-8'))
+    return "rgb({0},{1},{2})".format (205 + (h % 50), 80 + ((h >> 8) % 130), 40 + ((h >> 16) % 50))
+
+# ================================================================
+# For non-interactive invocations, call main() and use its return value
+# as the exit code.
+if __name__ == '__main__':
+  sys.exit (main (sys.argv))
@@ -0,0 +1,325 @@
+#!/usr/bin/python3
+
+# Copyright (c) 2018-2019 Bluespec, Inc.
+# See LICENSE for license details
+
+usage_line = (
+    "  Usage:\n"
+    "    $ <this_prog>    <opt flags>  <simulation_executable>  <repo_dir>  <logs_dir>  <xlen>  <baseline_file>\n"
+    "\n"
+    "  Runs the RISC-V <simulation_executable> on the benchmark ELF files\n"
+    "  <repo_dir>/Tests/c/rv<xlen>-<benchmark>, and collects the lines\n"
+    "      BENCH <name> cycles=<n> instret=<n> ipc=<n.nnn>\n"
+    "  that they print (see print_bench () in Tests/c/lib/riscv_counters.h).\n"
+    "\n"
+    "  Compares the cycle counts against <baseline_file>, and reports each\n"
+    "  benchmark as a regression or an improvement if its median cycle count moved\n"
+    "  by more than the threshold and by more than the run-to-run noise seen in the\n"
+    "  samples.  The exit code is nonzero if any benchmark regressed, failed (did\n"
+    "  not end with PASS through tohost, or timed out) or, being in the baseline,\n"
+    "  did not report.\n"
+    "\n"
+    "  Benchmarks given by --benchmarks must all exist and report.  Of the default\n"
+    "  ones, those without an ELF for <xlen> (not built and installed), and those\n"
+    "  that print no BENCH line (ELFs built before print_bench () existed), are\n"
+    "  skipped with a warning, unless the baseline has results for them; it is an\n"
+    "  error if none of them reports.\n"
+    "\n"
+    "  For each benchmark FOO, saves simulation output in <logs_dir>/FOO.<rep>.log,\n"
+    "  and saves all results in <logs_dir>/bench_results.json.\n"
+    "\n"
+    "  <opt flags> may be any of the following:\n"
+    "      --update              Write the results as the new <baseline_file> instead of comparing\n"
+    "      --benchmarks=<a,b,..> Benchmarks to run (default: {0})\n"
+    "      --reps=<n>            Runs per benchmark (default: 1; simulation is deterministic,\n"
+    "                              so use more only when results come from hardware)\n"
+    "      --threshold=<pct>     Smallest cycle-count change reported (default: {1}%)\n"
+    "      --timeout=<s>         Timeout per simulation (default: {2} s)\n"
+    "      --jobs=<n>            Parallel simulations (default: available CPUs)\n"
+    "\n"
+    "  Example:\n"
+    "      $ <this_prog>  exe_HW_chisel_p2_sim  .  ./Logs/bench/chisel_p2  64  Baselines/chisel_p2.json\n"
+)
+
+import sys
+import os
+import json
+import re
+import shutil
+import statistics
+import tempfile
+
+import multiprocessing
+
+from Run_regression import extract_flags, run_command
+
+# ================================================================
+# Benchmarks run by default, if their ELFs exist (see usage_line)
+
+default_benchmarks = ["filters", "intOpsTest", "paranoia", "dhrystone", "intmark", "kernels", "membench"]
+
+threshold_pct_default = 2.0
+timeout_default       = 3600
+timeout_elf_to_hex    = 60
+
+# Samples within this many (MAD-estimated) standard deviations are noise
+noise_sigmas = 3
+
+# ================================================================
+
+def main (argv = None):
+    print ("Use flag --help  or --h for a help message")
+    (flags, argv) = extract_flags (argv)
+    if ((len (argv) <= 1) or
+        (argv [1] == '-h') or (argv [1] == '--help') or
+        (len (argv) < 6)):
+
+        sys.stdout.write (usage_line.format (",".join (default_benchmarks),
+                                             threshold_pct_default, timeout_default))
+        sys.stdout.write ("\n")
+        return 0
+
+    sim_path = os.path.abspath (os.path.normpath (argv [1]))
+    if not os.path.exists (sim_path):
+        sys.stderr.write ("ERROR: The given simulation path does not seem to exist?\n")
+        sys.stderr.write ("    Simulation path: " + argv [1] + "\n")
+        return 1
+
+    repo          = os.path.abspath (os.path.normpath (argv [2]))
+    elfs_path     = os.path.join (repo, "Tests", "c")
+    elf_to_hex    = os.path.join (repo, "Tests", "elf_to_hex", "elf_to_hex")
+    logs_path     = os.path.abspath (os.path.normpath (argv [3]))
+    xlen          = argv [4]
+    baseline_path = os.path.abspath (os.path.normpath (argv [5]))
+
+    for path in (elfs_path, elf_to_hex):
+        if not os.path.exists (path):
+            sys.stderr.write ("ERROR: {0} does not exist?\n".format (path))
+            return 1
+    if xlen not in ("32", "64"):
+        sys.stderr.write ("ERROR: <xlen> must be 32 or 64, not '{0}'\n".format (xlen))
+        return 1
+    if not os.path.isdir (logs_path):
+        os.makedirs (logs_path)
+
+    explicit      = 'benchmarks' in flags
+    benchmarks    = flags.get ('benchmarks', ",".join (default_benchmarks)).split (",")
+    reps          = int (flags.get ('reps', 1))
+    threshold_pct = float (flags.get ('threshold', threshold_pct_default))
+    timeout       = float (flags.get ('timeout', timeout_default))
+    if hasattr (os, 'sched_getaffinity'):
+        n_jobs = len (os.sched_getaffinity (0))
+    else:
+        n_jobs = multiprocessing.cpu_count ()
+    n_jobs = int (flags.get ('jobs', n_jobs))
+
+    # ----------------
+    # Run every (benchmark, rep) as a separate simulation
+
+    jobs = []
+    for bench in benchmarks:
+        elf = os.path.join (elfs_path, "rv{0}-{1}".format (xlen, bench))
+        if not os.path.exists (elf):
+            if not explicit:
+                sys.stderr.write ("WARNING: skipping {0}: no {1} (make; make install XLEN={2}?)\n"
+                                  .format (bench, elf, xlen))
+                continue
+            sys.stderr.write ("ERROR: benchmark ELF {0} does not exist (make; make install XLEN={1}?)\n"
+                              .format (elf, xlen))
+            return 1
+        for rep in range (reps):
+            jobs.append ({'index':      len (jobs),
+                          'bench':      bench,
+                          'rep':        rep,
+                          'elf':        elf,
+                          'sim_path':   sim_path,
+                          'elf_to_hex': elf_to_hex,
+                          'logs_path':  logs_path,
+                          'timeout':    timeout})
+
+    if not jobs:
+        sys.stderr.write ("ERROR: none of the benchmarks {0} has an ELF for RV{1}\n"
+                          .format (",".join (benchmarks), xlen))
+        return 1
+
+    sys.stdout.write ("Running {0} simulations, {1} at a time\n".format (len (jobs), n_jobs))
+    with multiprocessing.Pool (max (1, min (n_jobs, len (jobs)))) as pool:
+        job_results = pool.map (do_job, jobs, chunksize = 1)
+
+    # ----------------
+    # Collect samples per BENCH name (a program may report several)
+
+    # A benchmark that failed is not compared: its BENCH lines, if any, are
+    # dropped, so that its baseline entries count as missing too
+    samples = {}
+    missing = []
+    failed  = []
+    for (job, (bench_lines, passed, message)) in zip (jobs, job_results):
+        sys.stdout.write (message)
+        if not passed:
+            if job ['bench'] not in failed:
+                failed.append (job ['bench'])
+            continue
+        if not bench_lines:
+            missing.append (job ['bench'])
+        for (name, cycles, instret) in bench_lines:
+            entry = samples.setdefault (name, {'cycles': [], 'instret': []})
+            entry ['cycles'].append (cycles)
+            entry ['instret'].append (instret)
+
+    results = {'sim_path':   sim_path,
+               'xlen':       xlen,
+               'benchmarks': samples}
+    results_path = os.path.join (logs_path, "bench_results.json")
+    write_json (results_path, results)
+    sys.stdout.write ("Results saved in: {0}\n".format (results_path))
+
+    for bench in failed:
+        sys.stdout.write ("ERROR: {0}: FAIL (no PASS through tohost, or TIMEOUT; see logs)\n"
+                          .format (bench))
+    for bench in missing:
+        sys.stdout.write ("{0}: {1}: no BENCH line in output (see logs{2})\n"
+                          .format ("ERROR" if explicit else "WARNING", bench,
+                                   "" if explicit else "; rebuild it to include print_bench ()"))
+    if not samples:
+        sys.stdout.write ("ERROR: no benchmark printed a BENCH line\n")
+        return 1
+    if not explicit:
+        missing = []
+
+    if 'update' in flags:
+        if failed or missing:
+            sys.stdout.write ("ERROR: baseline {0} not saved\n".format (baseline_path))
+            return 1
+        write_json (baseline_path, results)
+        sys.stdout.write ("Baseline saved in: {0}\n".format (baseline_path))
+        return 0
+
+    # ----------------
+    # Compare against the baseline
+
+    try:
+        with open (baseline_path, 'r') as fd:
+            baseline = json.load (fd) ['benchmarks']
+    except (OSError, ValueError, KeyError):
+        sys.stderr.write ("ERROR: cannot read baseline {0} (create it with --update)\n"
+                          .format (baseline_path))
+        return 1
+
+    n_regressions = 0
+    sys.stdout.write ("{0:<24} {1:>14} {2:>14} {3:>8} {4:>8}  {5}\n"
+                      .format ("Benchmark", "base cycles", "cycles", "change", "noise", "verdict"))
+    for name in sorted (samples):
+        if name not in baseline:
+            sys.stdout.write ("{0:<24} {1:>14} {2:>14} {3:>8} {4:>8}  new (not in baseline)\n"
+                              .format (name, "-", statistics.median (samples [name]['cycles']), "-", "-"))
+            continue
+        (verdict, base, new, change, noise) = compare (baseline [name], samples [name], threshold_pct)
+        if verdict == "REGRESSION":
+            n_regressions = n_regressions + 1
+        sys.stdout.write ("{0:<24} {1:>14.0f} {2:>14.0f} {3:>+7.2f}% {4:>7.2f}%  {5}\n"
+                          .format (name, base, new, change, noise, verdict))
+    # Whatever the baseline has and this run did not report (benchmark
+    # not built, failed, or no longer printing that BENCH line) is a failure
+    not_reported = sorted (set (baseline) - set (samples))
+    for name in not_reported:
+        sys.stdout.write ("{0:<24} MISSING (in baseline, but not reported)\n".format (name))
+
+    sys.stdout.write ("{0} regression(s), {1} failed benchmark(s), {2} missing result(s) against {3}\n"
+                      .format (n_regressions, len (failed), len (not_reported), baseline_path))
+    return 0 if (n_regressions == 0 and not failed and not missing and not not_reported) else 1
+
+# ================================================================
+# Compare baseline and new samples of one benchmark.
+# Returns (verdict, base median, new median, change %, noise %).
+# The noise estimate is noise_sigmas times the robust (MAD-based)
+# standard deviation of both sample sets, relative to the baseline
+# median; with a single deterministic simulation sample it is zero,
+# and any change beyond the threshold is reported.
+
+def compare (base_entry, new_entry, threshold_pct):
+    base = statistics.median (base_entry ['cycles'])
+    new  = statistics.median (new_entry  ['cycles'])
+    change_pct = 100.0 * (new - base) / base if base else 0.0
+
+    def mad_sigma (xs):
+        m = statistics.median (xs)
+        return 1.4826 * statistics.median ([abs (x - m) for x in xs])
+
+    sigma     = max (mad_sigma (base_entry ['cycles']), mad_sigma (new_entry ['cycles']))
+    noise_pct = 100.0 * noise_sigmas * sigma / base if base else 0.0
+    limit_pct = max (threshold_pct, noise_pct)
+
+    if change_pct > limit_pct:
+        verdict = "REGRESSION"
+    elif change_pct < - limit_pct:
+        verdict = "improvement"
+    else:
+        verdict = "ok"
+
+    # A change in instructions executed points at the program or the
+    # toolchain rather than at the processor
+    base_instret = statistics.median (base_entry ['instret'])
+    new_instret  = statistics.median (new_entry  ['instret'])
+    if (verdict != "ok") and (base_instret != new_instret):
+        verdict = verdict + " (instret {0:.0f} -> {1:.0f})".format (base_instret, new_instret)
+
+    return (verdict, base, new, change_pct, noise_pct)
+
+# ================================================================
+# Run one benchmark ELF in the simulator, in a private directory
+# (for Mem.hex and symbol_table.txt); returns (bench lines, passed,
+# message).  It passed if it ended with PASS through tohost, in time, as
+# for the ISA tests (Run_regression.py).
+
+re_bench = re.compile (r"^BENCH (\S+) cycles=(\d+) instret=(\d+)", re.MULTILINE)
+
+def do_job (job):
+    tmpdir = tempfile.mkdtemp (prefix = "bench_", dir = ".")
+    try:
+        cwd = os.getcwd ()
+        os.chdir (tmpdir)
+        try:
+            (stdout1, timed_out1, _) = run_command ([job ['elf_to_hex'], job ['elf'], "Mem.hex"],
+                                                    timeout_elf_to_hex)
+            command2 = [job ['sim_path'], "+tohost",
+                        "+jtag_port={0}".format (20000 + job ['index']),
+                        "+vpi_port={0}".format  (30000 + job ['index'])]
+            (stdout2, timed_out2, _) = run_command (command2, job ['timeout'])
+        finally:
+            os.chdir (cwd)
+    finally:
+        shutil.rmtree (tmpdir, ignore_errors = True)
+
+    log_filename = os.path.join (job ['logs_path'], "{0}.{1}.log".format (job ['bench'], job ['rep']))
+    with open (log_filename, 'w') as fd:
+        fd.write (stdout1)
+        fd.write (stdout2)
+        if timed_out1 or timed_out2:
+            fd.write ("\nTIMEOUT\n")
+
+    timed_out   = timed_out1 or timed_out2
+    passed      = (not timed_out) and (stdout2.find ("PASS") != -1)
+    bench_lines = [(name, int (cycles), int (instret))
+                   for (name, cycles, instret) in re_bench.findall (stdout2)]
+    message = "    {0} rep {1}: {2}, {3} BENCH line(s){4}; log: {5}\n".format (
+        job ['bench'], job ['rep'], "PASS" if passed else "FAIL", len (bench_lines),
+        " (TIMEOUT)" if timed_out else "", log_filename)
+    return (bench_lines, passed, message)
+
+# ================================================================
+
+def write_json (path, obj):
+    if not os.path.isdir (os.path.dirname (path)):
+        os.makedirs (os.path.dirname (path))
+    tmp_path = path + ".tmp"
+    with open (tmp_path, 'w') as fd:
+        json.dump (obj, fd, indent = 1, sort_keys = True)
+        fd.write ("\n")
+    os.replace (tmp_path, path)
+
+# ================================================================
+# For non-interactive invocations, call main() and use its return value
+# as the exit code.
+if __name__ == '__main__':
+  sys.exit (main (sys.argv))
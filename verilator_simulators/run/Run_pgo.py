@@ -0,0 +1,304 @@
+#!/usr/bin/python3
+
+# Copyright (c) 2019 Bluespec, Inc.
+# See LICENSE for license details
+
+usage_line = (
+    "  Usage:\n"
+    "    $ <this_prog>    <opt flags>  <simulation_executable>  <repo_dir>  <logs_dir>  <arch>\n"
+    "\n"
+    "  Runs the workload used for profile-guided builds of the simulator\n"
+    "  (\"make simulator_pgo\" in the parent directory):\n"
+    "    - the ISA tests relevant to architecture <arch>, from <repo_dir>/Tests/isa\n"
+    "      (selected as by Run_regression.py), each until it writes tohost;\n"
+    "    - if --linux is given and the file exists, a Linux boot from that DDR\n"
+    "      image (see run_linux in the Makefile), for --linux_cycles cycles;\n"
+    "      ignored, with a warning, if <arch> is RV32 (the image is RV64).\n"
+    "\n"
+    "  Without --compare, runs each item once in <simulation_executable> (e.g. an\n"
+    "  instrumented build, whose profiles are merged as each run exits), several\n"
+    "  at a time.\n"
+    "\n"
+    "  With --compare=<base_executable>, runs each item, one at a time, in\n"
+    "  <base_executable> and then in <simulation_executable>, checks that both\n"
+    "  simulated the same number of cycles, and reports the wall times and the\n"
+    "  speedup of <simulation_executable> over <base_executable>: for the ISA\n"
+    "  tests, for the Linux boot and in total.  The exit code is nonzero if any\n"
+    "  run failed or the two disagree.\n"
+    "\n"
+    "  For each item FOO, saves simulation output in <logs_dir>/FOO.log (and\n"
+    "  <logs_dir>/FOO.base.log), and with --compare all timings in\n"
+    "  <logs_dir>/pgo_compare.json.\n"
+    "\n"
+    "  <opt flags> may be any of the following:\n"
+    "      --compare=<exe>       Time <simulation_executable> against <exe>\n"
+    "      --linux=<hex_file>    DDR image of the Linux boot (omitted if the file does not exist)\n"
+    "      --linux_cycles=<n>    Cycles of the Linux boot to simulate (default: {0})\n"
+    "      --reps=<n>            With --compare, timed runs per item and executable;\n"
+    "                              the fastest is used (default: 1)\n"
+    "      --timeout=<s>         Timeout per simulation (default: {1} s)\n"
+    "      --jobs=<n>            Without --compare, parallel simulations (default: available CPUs)\n"
+    "\n"
+    "  Example:\n"
+    "      $ <this_prog>  --compare=exe_HW_bluespec_p2_sim_base  exe_HW_bluespec_p2_sim  .  ./Logs/pgo  RV64IMAFDCSU\n"
+)
+
+import sys
+import os
+import json
+import shutil
+import subprocess
+import tempfile
+import time
+
+import multiprocessing
+
+from Run_regression import (extract_flags, extract_arch_string, select_test_families,
+                            traverse, extract_metrics)
+from Run_benchmarks import write_json
+
+linux_cycles_default = 5000000
+timeout_default      = 3600
+timeout_elf_to_hex   = 60
+
+# ================================================================
+
+def main (argv = None):
+    print ("Use flag --help  or --h for a help message")
+    (flags, argv) = extract_flags (argv)
+    if ((len (argv) <= 1) or
+        (argv [1] == '-h') or (argv [1] == '--help') or
+        (len (argv) < 5)):
+
+        sys.stdout.write (usage_line.format (linux_cycles_default, timeout_default))
+        sys.stdout.write ("\n")
+        return 0
+
+    sim_path = os.path.abspath (os.path.normpath (argv [1]))
+    base_path = None
+    if 'compare' in flags:
+        base_path = os.path.abspath (os.path.normpath (flags ['compare']))
+    for path in (sim_path, base_path):
+        if (path != None) and not os.path.exists (path):
+            sys.stderr.write ("ERROR: The given simulation path does not seem to exist?\n")
+            sys.stderr.write ("    Simulation path: " + path + "\n")
+            return 1
+
+    repo       = os.path.abspath (os.path.normpath (argv [2]))
+    elfs_path  = os.path.join (repo, "Tests", "isa")
+    elf_to_hex = os.path.join (repo, "Tests", "elf_to_hex", "elf_to_hex")
+    logs_path  = os.path.abspath (os.path.normpath (argv [3]))
+    for path in (elfs_path, elf_to_hex):
+        if not os.path.exists (path):
+            sys.stderr.write ("ERROR: {0} does not exist?\n".format (path))
+            return 1
+    if not os.path.isdir (logs_path):
+        os.makedirs (logs_path)
+
+    arch_string   = extract_arch_string (argv [4])
+    test_families = select_test_families (arch_string)
+
+    linux_cycles = int (flags.get ('linux_cycles', linux_cycles_default))
+    reps         = max (1, int (flags.get ('reps', 1)))
+    timeout      = float (flags.get ('timeout', timeout_default))
+    if hasattr (os, 'sched_getaffinity'):
+        n_jobs = len (os.sched_getaffinity (0))
+    else:
+        n_jobs = multiprocessing.cpu_count ()
+    n_jobs = int (flags.get ('jobs', n_jobs))
+
+    # ----------------
+    # The workload: (name, group, hex source, plusargs)
+
+    def fn_filter_regular_file (level, filename):
+        basename = os.path.basename (filename)
+        if "." in basename: return False
+        return any (basename.find (x) != -1 for x in test_families)
+
+    items = []
+    for elf in sorted (traverse (lambda level, filename: True, fn_filter_regular_file, 0, elfs_path)):
+        items.append ({'name': os.path.basename (elf), 'group': "isa",
+                       'elf': elf, 'hex': None, 'plusargs': ["+tohost"]})
+
+    linux_hex = flags.get ('linux')
+    if linux_hex and arch_string.startswith ("RV32"):
+        sys.stdout.write ("WARNING: {0} is an RV64 image; workload for {1} has no Linux boot\n"
+                          .format (linux_hex, arch_string))
+    elif linux_hex and os.path.exists (linux_hex):
+        items.append ({'name': "linux_boot", 'group': "linux",
+                       'elf': None, 'hex': os.path.abspath (linux_hex),
+                       'plusargs': ["+max_cycles={0}".format (linux_cycles)]})
+    elif linux_hex:
+        sys.stdout.write ("WARNING: {0} does not exist; workload has no Linux boot\n"
+                          .format (linux_hex))
+        sys.stdout.write ("    (build it with 'make sim' in the bootmem directory)\n")
+
+    if not items:
+        sys.stderr.write ("ERROR: no ISA tests for {0} under {1}, and no Linux image\n"
+                          .format (arch_string, elfs_path))
+        return 1
+
+    for (j, item) in enumerate (items):
+        item.update ({'index': j, 'elf_to_hex': elf_to_hex,
+                      'logs_path': logs_path, 'timeout': timeout})
+
+    n_isa = len ([item for item in items if item ['group'] == "isa"])
+    sys.stdout.write ("Workload: {0} ISA tests for {1}{2}\n"
+                      .format (n_isa, arch_string,
+                               "" if n_isa == len (items)
+                               else ", {0} cycles of Linux boot".format (linux_cycles)))
+
+    if base_path == None:
+        return train (sim_path, items, n_jobs)
+    else:
+        return compare (base_path, sim_path, items, reps, logs_path)
+
+# ================================================================
+# Training: run every item once, several at a time
+
+def train (sim_path, items, n_jobs):
+    jobs = [dict (item, sim_path = sim_path, tag = "") for item in items]
+    sys.stdout.write ("Running {0} simulations, {1} at a time\n".format (len (jobs), n_jobs))
+    with multiprocessing.Pool (max (1, min (n_jobs, len (jobs)))) as pool:
+        job_results = pool.map (do_job, jobs, chunksize = 1)
+
+    n_failed = 0
+    for (job, result) in zip (jobs, job_results):
+        if not result ['ok']:
+            n_failed = n_failed + 1
+            sys.stdout.write ("    {0}: {1}; log: {2}\n".format (job ['name'], result ['error'], result ['log']))
+    sys.stdout.write ("Training runs: {0}, failed: {1}\n".format (len (jobs), n_failed))
+
+    # A failed run still profiles the code it ran; only fail if none ran
+    return 0 if n_failed < len (jobs) else 1
+
+# ================================================================
+# Comparison: run every item in both executables, one at a time so that
+# the timings do not disturb each other, and report the speedup
+
+def compare (base_path, sim_path, items, reps, logs_path):
+    rows     = []
+    n_errors = 0
+    for item in items:
+        best = {}
+        for rep in range (reps):
+            for (tag, path) in ((".base", base_path), ("", sim_path)):
+                result = do_job (dict (item, sim_path = path, tag = tag))
+                if not result ['ok']:
+                    best [tag] = result
+                    break
+                if (tag not in best) or (result ['wall'] < best [tag]['wall']):
+                    best [tag] = result
+        (base, new) = (best [".base"], best.get (""))
+
+        if not base ['ok'] or (new == None) or not new ['ok']:
+            bad = base if not base ['ok'] else new
+            sys.stdout.write ("ERROR: {0}: {1}; log: {2}\n".format (item ['name'], bad ['error'], bad ['log']))
+            n_errors = n_errors + 1
+            continue
+        if base ['cycles'] != new ['cycles']:
+            sys.stdout.write ("ERROR: {0}: simulated {1} cycles, but {2} in the base simulator\n"
+                              .format (item ['name'], new ['cycles'], base ['cycles']))
+            n_errors = n_errors + 1
+        rows.append ({'name':      item ['name'],
+                      'group':     item ['group'],
+                      'cycles':    new ['cycles'],
+                      'base_wall': base ['wall'],
+                      'wall':      new ['wall']})
+
+    # ----------------
+
+    def fmt_row (label, cycles, base_wall, wall):
+        speedup = (base_wall / wall) if wall > 0 else float ("nan")
+        return ("{0:<28} {1:>12} {2:>10.2f} {3:>10.2f} {4:>8.3f}x\n"
+                .format (label, cycles, base_wall, wall, speedup))
+
+    sys.stdout.write ("Base simulator: {0}\n".format (base_path))
+    sys.stdout.write ("New simulator:  {0}\n".format (sim_path))
+    sys.stdout.write ("{0:<28} {1:>12} {2:>10} {3:>10} {4:>9}\n"
+                      .format ("Workload", "cycles", "base (s)", "new (s)", "speedup"))
+    totals = {}
+    for group in ("isa", "linux", "total"):
+        selected = [r for r in rows if group in (r ['group'], "total")]
+        if not selected:
+            continue
+        label = {"isa":   "ISA tests ({0})".format (len (selected)),
+                 "linux": "Linux boot",
+                 "total": "Total"} [group]
+        totals [group] = {'items':     len (selected),
+                          'cycles':    sum (r ['cycles'] for r in selected),
+                          'base_wall': sum (r ['base_wall'] for r in selected),
+                          'wall':      sum (r ['wall'] for r in selected)}
+        sys.stdout.write (fmt_row (label, totals [group]['cycles'],
+                                   totals [group]['base_wall'], totals [group]['wall']))
+
+    results_path = os.path.join (logs_path, "pgo_compare.json")
+    write_json (results_path, {'base_sim_path': base_path,
+                               'sim_path':      sim_path,
+                               'items':         rows,
+                               'totals':        totals})
+    sys.stdout.write ("Results saved in: {0}\n".format (results_path))
+
+    return 0 if n_errors == 0 else 1
+
+# ================================================================
+# Run one workload item in job ['sim_path'], in a private directory (for
+# Mem.hex and symbol_table.txt).  Returns a dict with 'ok', 'error',
+# 'cycles', 'wall' (of the simulator alone) and 'log'.
+
+def do_job (job):
+    log_filename = os.path.join (job ['logs_path'], job ['name'] + job ['tag'] + ".log")
+    result = {'ok': False, 'error': None, 'cycles': None, 'wall': None, 'log': log_filename}
+
+    tmpdir = tempfile.mkdtemp (prefix = "pgo_", dir = ".")
+    try:
+        with open (log_filename, 'w') as fd:
+            if job ['elf'] != None:
+                command1 = [job ['elf_to_hex'], job ['elf'], "Mem.hex"]
+                if run (command1, tmpdir, fd, timeout_elf_to_hex) == None:
+                    result ['error'] = "elf_to_hex failed"
+                    return result
+            else:
+                os.symlink (job ['hex'], os.path.join (tmpdir, "Mem.hex"))
+
+            command2 = ([job ['sim_path']] + job ['plusargs'] +
+                        ["+jtag_port={0}".format (20000 + job ['index']),
+                         "+vpi_port={0}".format  (30000 + job ['index'])])
+            fd.flush ()
+            wall = run (command2, tmpdir, fd, job ['timeout'])
+    finally:
+        shutil.rmtree (tmpdir, ignore_errors = True)
+
+    if wall == None:
+        result ['error'] = "simulation failed or timed out"
+        return result
+
+    with open (log_filename, 'r', errors = 'replace') as fd:
+        result ['cycles'] = extract_metrics (fd.read ()) ['cycles']
+    if result ['cycles'] == None:
+        result ['error'] = "no 'Simulated cycles' line in output"
+        return result
+
+    result ['ok']   = True
+    result ['wall'] = wall
+    return result
+
+# Run command in dir, appending its output to fd; returns its wall time
+# in seconds, or None if it timed out or exited with nonzero status
+
+def run (command, dir, fd, timeout):
+    start = time.monotonic ()
+    try:
+        status = subprocess.call (command, cwd = dir, stdout = fd, stderr = subprocess.STDOUT,
+                                  timeout = timeout)
+    except subprocess.TimeoutExpired:
+        fd.write ("\nTIMEOUT\n")
+        return None
+    wall = time.monotonic () - start
+    return wall if status == 0 else None
+
+# ================================================================
+# For non-interactive invocations, call main() and use its return value
+# as the exit code.
+if __name__ == '__main__':
+  sys.exit (main (sys.argv))
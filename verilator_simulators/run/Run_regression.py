@@ -5,7 +5,7 @@
 
 usage_line = (
     "  Usage:\n"
-    "    $ <this_prog>    <simulation_executable>  <repo_dir>  <logs_dir>  <arch>  <opt verbosity>  <opt parallelism>\n"
+    "    $ <this_prog>    <opt flags>  <simulation_executable>  <repo_dir>  <logs_dir>  <arch>  <opt verbosity>  <opt parallelism>\n"
     "\n"
     "  Runs the RISC-V <simulation_executable>\n"
     "  on ISA tests: ELF files taken from <repo-dir>/isa and its sub-directories.\n"
@@ -21,8 +21,34 @@ usage_line = (
     "  If <opt parallelism> is given, it must be an integer\n"
     "      Specifies the number of parallel processes used\n"
     "        (creates temporary separate working directories worker_0, worker_1, ...)\n"
-    "      By default uses 1/2 the CPUs listed in /proc/cpuinfo.\n"
-    "      In any case, limits it to 4.\n"
+    "      By default uses as many processes as there are CPUs available to this process,\n"
+    "        reduced if MemAvailable in /proc/meminfo cannot hold that many simulators.\n"
+    "\n"
+    "  Tests are dispatched longest-first, using runtimes recorded by previous runs;\n"
+    "  each worker takes the next test as soon as it finishes its current one.\n"
+    "  Each test's timeout is derived from its recorded runtime.\n"
+    "\n"
+    "  <opt flags> may be any of the following:\n"
+    "      --history=<file>      Runtime history file\n"
+    "                              (default: <logs_dir>.history.json, which survives 'rm -rf <logs_dir>/*')\n"
+    "      --mem_per_sim=<MB>    Memory assumed per simulator process when sizing the pool\n"
+    "      --cache_dir=<dir>     Result cache directory (default: <logs_dir>/../.cache)\n"
+    "      --force               Simulate every test even if its result is in the cache\n"
+    "      --rom_files=<f1,f2,..> Boot ROM and flash images loaded by a DPI_ROM=1 simulator,\n"
+    "                              for the cache key (default: ../procs/<proc>/boot_rom.bin\n"
+    "                              and flash.bin, <proc> from the name exe_HW_<proc>_sim)\n"
+    "      --json=<file>         Results summary in JSON     (default: <logs_dir>/results.json)\n"
+    "      --junit=<file>        Results summary in JUnit XML (default: <logs_dir>/results.xml)\n"
+    "\n"
+    "  The summaries record, per test: PASS/FAIL, wall time, simulated cycles,\n"
+    "  instructions retired (the core's minstret, when the simulator reports it),\n"
+    "  simulation speed in kHz and peak RSS of the simulator, plus aggregates\n"
+    "  per ISA test family.\n"
+    "\n"
+    "  Results are cached, keyed on the hashes of the simulation executable, of\n"
+    "  elf_to_hex, of the boot ROM and flash images (--rom_files) and of the ELF\n"
+    "  file, and on the simulator plusargs; a test whose key is already in the\n"
+    "  cache is not simulated again, and its cached log is used instead.\n"
     "\n"
     "  Example:\n"
     "      $ <this_prog>  .exe_HW_sim  ~somebody/GitHub/Piccolo  ./Logs  RV32IMU  v1 4\n"
@@ -44,18 +70,41 @@ import stat
 import subprocess
 
 import multiprocessing
+import queue
+import json
+import time
+import hashlib
+import shutil
+import re
+import tempfile
+import xml.etree.ElementTree
 
 # ================================================================
 # DEBUGGING ONLY: This exclude list allows skipping some specific test
 
 exclude_list = []
 
-n_workers_max = 4
+# ================================================================
+# Scheduling parameters
+
+# Memory (MB) assumed for one simulator process when sizing the worker pool
+mem_per_sim_MB_default = 1024
+
+# Per-test timeouts (seconds).  A test with no recorded runtime gets
+# timeout_default; otherwise it gets timeout_factor times its recorded
+# runtime, but never less than timeout_min.
+timeout_default = 120
+timeout_min     = 30
+timeout_factor  = 4
+
+# Timeout (seconds) for elf_to_hex
+timeout_elf_to_hex = 60
 
 # ================================================================
 
 def main (argv = None):
     print ("Use flag --help  or --h for a help message")
+    (flags, argv) = extract_flags (argv)
     if ((len (argv) <= 1) or
         (argv [1] == '-h') or (argv [1] == '--help') or
         (len (argv) < 5)):
@@ -67,7 +116,7 @@ def main (argv = None):
     # Simulation executable
     if not (os.path.exists (argv [1])):
         sys.stderr.write ("ERROR: The given simulation path does not seem to exist?\n")
-        sys.stderr.write ("    Simulation path: " + sim_path + "\n")
+        sys.stderr.write ("    Simulation path: " + argv [1] + "\n")
         sys.exit (1)
     args_dict = {'sim_path': os.path.abspath (os.path.normpath (argv [1]))}
 
@@ -96,9 +145,23 @@ def main (argv = None):
     for path in (logs_path, pass_path, fail_path):
         if not os.path.isdir (path):
             print ("Creating dir: " + path)
-            os.mkdir (path)
+            os.makedirs (path)
     args_dict ['logs_path'] = logs_path
 
+    # Runtime history from previous runs
+    history_path = flags.get ('history', logs_path + ".history.json")
+    history_path = os.path.abspath (os.path.normpath (history_path))
+    history      = read_history (history_path)
+
+    # Result cache
+    cache_path = flags.get ('cache_dir', os.path.join (os.path.dirname (logs_path), ".cache"))
+    cache_path = os.path.abspath (os.path.normpath (cache_path))
+    if not os.path.isdir (cache_path):
+        os.makedirs (cache_path)
+    args_dict ['cache_path'] = cache_path
+    args_dict ['force']      = ('force' in flags)
+    args_dict ['sim_hash']   = hash_file (args_dict ['sim_path'])
+
     # Architecture string and implied ISA test families
     arch_string = extract_arch_string (argv [4])
     if (arch_string == None):
@@ -127,13 +190,11 @@ def main (argv = None):
             j = 6
     args_dict ['verbosity'] = verbosity
 
-    # Optional parallelism; limit it to 8
+    # Optional parallelism
     if len (argv [j:]) != 0 and argv [j].isdecimal():
         n_workers = int (argv [j])
     else:
-        n_workers = multiprocessing.cpu_count () // 2
-    n_workers = min (n_workers_max, n_workers)
-    sys.stdout.write ("Using {0} worker processes\n".format (n_workers))
+        n_workers = default_n_workers (history, flags)
 
     # End of command-line arg processing
     # ================================================================
@@ -149,6 +210,20 @@ def main (argv = None):
         return 1
     args_dict ['elf_to_hex_exe'] = elf_to_hex_exe
 
+    # Inputs of every simulation besides the simulator and the ELF, for the
+    # cache key: elf_to_hex, and the boot ROM and flash images that a
+    # DPI_ROM=1 simulator loads at startup (hashed even if the simulator
+    # has them compiled in, which only costs a re-run after editing them)
+    rom_files = flags.get ('rom_files', True)
+    if rom_files == True:
+        rom_files = default_rom_files (args_dict ['sim_path'])
+    else:
+        rom_files = [os.path.abspath (f) for f in rom_files.split (",") if f]
+    args_dict ['rom_files']   = rom_files
+    args_dict ['inputs_hash'] = hash_string ("\n".join (
+        [hash_file (elf_to_hex_exe)]
+        + [hash_file (f) if os.path.exists (f) else "missing " + f for f in rom_files]))
+
     sys.stdout.write ("Parameters:\n")
     for key in iter (args_dict):
         sys.stdout.write ("    {0:<16}: {1}\n".format (key, args_dict [key]))
@@ -178,13 +253,32 @@ def main (argv = None):
     sys.stdout.write ("{0} relevant isa tests found under {1}\n".format (n_tests, elfs_path))
     if n_tests == 0:
         return 0
+
+    # Longest-first: tests with no recorded runtime go first of all, since
+    # nothing is known about them; ties are broken by name for repeatability.
+    def fn_sort_key (filename):
+        wall = history_wall (history, os.path.basename (filename))
+        return (- (wall if wall != None else float ("inf")), filename)
+
+    filenames = sorted (filenames, key = fn_sort_key)
+    timeouts  = [test_timeout (history, os.path.basename (f)) for f in filenames]
     args_dict ['filenames'] = filenames
+    args_dict ['timeouts']  = timeouts
     args_dict ['n_tests']   = n_tests
 
-    # Create a shared counter to index into the list of filenames
+    n_workers = max (1, min (n_workers, n_tests))
+    sys.stdout.write ("Using {0} worker processes\n".format (n_workers))
+
+    # Create a shared counter to index into the list of filenames.
+    # Workers claim the next test whenever they become idle, so a worker
+    # that draws short tests keeps taking more while others run long ones.
     index = multiprocessing.Value ('L', 0)    # Unsigned long (4 bytes)
     args_dict ['index'] = index
 
+    # Create a queue on which workers report (basename, result) per test
+    reports = multiprocessing.Queue ()
+    args_dict ['reports'] = reports
+
     # Create a shared array for each worker's (n_executed, n_passed) results
     results = multiprocessing.Array ('L', [ 0 for j in range (2 * n_workers) ])
     args_dict ['results'] = results
@@ -198,9 +292,49 @@ def main (argv = None):
     # Start the workers
     for worker in workers: worker.start ()
 
+    # Collect per-test reports while the workers run (draining the queue
+    # before join() avoids blocking workers on a full pipe)
+    n_reports   = 0
+    n_cached    = 0
+    all_results = {}
+    while n_reports < n_tests:
+        try:
+            (basename, result) = reports.get (timeout = 1)
+        except queue.Empty:
+            if not any (worker.is_alive () for worker in workers): break
+            continue
+        n_reports = n_reports + 1
+        all_results [basename] = result
+        # A timed-out run says nothing about the test's real runtime,
+        # and a cache hit says nothing about this host's
+        if result ['cached']:
+            n_cached = n_cached + 1
+        elif not result ['timed_out']:
+            history [basename] = {'wall': round (result ['wall'], 3)}
+            if result.get ('peak_rss_kb') != None:
+                history [basename]['peak_rss_kb'] = result ['peak_rss_kb']
+
     # Wait for all workers to finish
     for worker in workers: worker.join ()
 
+    write_history (history_path, history)
+    sys.stdout.write ("Runtime history saved in: {0}\n".format (history_path))
+
+    # Machine-readable summaries
+    summary = make_summary (args_dict, all_results)
+    json_path  = flags.get ('json',  os.path.join (logs_path, "results.json"))
+    junit_path = flags.get ('junit', os.path.join (logs_path, "results.xml"))
+    with open (json_path, 'w') as fd:
+        json.dump (summary, fd, indent = 1, sort_keys = True)
+        fd.write ("\n")
+    write_junit (junit_path, summary)
+    sys.stdout.write ("Results summary saved in: {0} and {1}\n".format (json_path, junit_path))
+    for (family, agg) in sorted (summary ['families'].items ()):
+        sys.stdout.write ("    {0:<10} {1:>4} tests {2:>4} PASS  {3:>10} cycles  {4}\n"
+                          .format (family, agg ['tests'], agg ['passed'], agg ['cycles'],
+                                   "" if agg ['khz'] == None
+                                   else "{0:.1f} kHz".format (agg ['khz'])))
+
     # Collect all results
     num_executed = 0
     num_passed   = 0
@@ -215,13 +349,99 @@ def main (argv = None):
 
     # Write final statistics
     sys.stdout.write ("Total tests: {0} tests\n".format (n_tests))
-    sys.stdout.write ("Executed:    {0} tests\n".format (num_executed))
+    sys.stdout.write ("Executed:    {0} tests ({1} results from cache)\n".format (num_executed, n_cached))
     sys.stdout.write ("PASS:        {0} tests\n".format (num_passed))
     sys.stdout.write ("FAIL:        {0} tests\n".format (num_executed - num_passed))
 
     # Set nonzero exit code unless all tests passed
     return 0 if num_passed == n_tests else 1
 
+# ================================================================
+# Remove '--name=value' and '--name' flags from argv; return
+# (dict of flags, remaining argv).  '--help' and '--h' are left in place.
+
+def extract_flags (argv):
+    flags = {}
+    rest  = argv [:1]
+    for arg in argv [1:]:
+        if arg.startswith ("--") and (arg not in ("--help", "--h")):
+            (name, sep, value) = arg [2:].partition ("=")
+            flags [name] = value if sep else True
+        else:
+            rest.append (arg)
+    return (flags, rest)
+
+# ================================================================
+# Runtime history: a JSON dict mapping test basename to a dict of
+# measurements from its most recent completed run, e.g.
+#     { "rv64ui-p-add": { "wall": 1.234 }, ... }
+
+def read_history (path):
+    try:
+        with open (path, 'r') as fd:
+            history = json.load (fd)
+        if isinstance (history, dict):
+            return history
+    except (OSError, ValueError):
+        pass
+    return {}
+
+def write_history (path, history):
+    # Write-then-rename so an interrupted run never leaves a truncated file
+    tmp_path = path + ".tmp"
+    with open (tmp_path, 'w') as fd:
+        json.dump (history, fd, indent = 1, sort_keys = True)
+        fd.write ("\n")
+    os.replace (tmp_path, path)
+
+def history_wall (history, basename):
+    entry = history.get (basename)
+    if isinstance (entry, dict) and isinstance (entry.get ('wall'), (int, float)):
+        return entry ['wall']
+    return None
+
+def test_timeout (history, basename):
+    wall = history_wall (history, basename)
+    if wall == None:
+        return timeout_default
+    return max (timeout_min, timeout_factor * wall)
+
+# ================================================================
+# Default worker-pool size: one worker per available CPU, limited by
+# how many simulator processes fit in MemAvailable
+
+def default_n_workers (history, flags):
+    if hasattr (os, 'sched_getaffinity'):
+        n_cpus = len (os.sched_getaffinity (0))
+    else:
+        n_cpus = multiprocessing.cpu_count ()
+
+    if 'mem_per_sim' in flags:
+        mem_per_sim_MB = int (flags ['mem_per_sim'])
+    else:
+        # Largest recorded peak RSS, with some headroom, if that is larger
+        rss_kb = [entry.get ('peak_rss_kb') or 0 for entry in history.values ()
+                  if isinstance (entry, dict)]
+        mem_per_sim_MB = max ([mem_per_sim_MB_default]
+                              + [(3 * kb) // (2 * 1024) for kb in rss_kb])
+
+    mem_avail_MB = None
+    try:
+        with open ("/proc/meminfo", 'r') as fd:
+            for line in fd:
+                if line.startswith ("MemAvailable:"):
+                    mem_avail_MB = int (line.split () [1]) // 1024
+    except OSError:
+        pass
+
+    n_workers = n_cpus
+    if mem_avail_MB != None:
+        n_workers = min (n_workers, mem_avail_MB // max (1, mem_per_sim_MB))
+    n_workers = max (1, n_workers)
+    sys.stdout.write ("{0} CPUs, {1} MB available, {2} MB per simulator => {3} workers\n"
+                      .format (n_cpus, mem_avail_MB, mem_per_sim_MB, n_workers))
+    return n_workers
+
 # ================================================================
 # Extract the architecture string (e.g., RV64AIMSU) from the string s
 
@@ -332,8 +552,10 @@ def do_worker (worker_num, args_dict):
 
     n_tests   = args_dict ['n_tests']
     filenames = args_dict ['filenames']
+    timeouts  = args_dict ['timeouts']
     index     = args_dict ['index']
     results   = args_dict ['results']
+    reports   = args_dict ['reports']
 
     num_executed = 0
     num_passed   = 0
@@ -351,15 +573,21 @@ def do_worker (worker_num, args_dict):
             return
         filename = filenames [my_index]
 
-        (message, passed) = do_isa_test (worker_num, args_dict, filename)
+        (message, result) = do_isa_test (worker_num, args_dict, filename, timeouts [my_index])
+        reports.put ((os.path.basename (filename), result))
         num_executed = num_executed + 1
 
-        if passed:
+        if result ['passed']:
             num_passed = num_passed + 1
             pass_fail = "PASS"
         else:
             pass_fail = "FAIL"
 
+        if result ['timed_out']:
+            pass_fail = pass_fail + " (TIMEOUT)"
+        elif result ['cached']:
+            pass_fail = pass_fail + " (cached)"
+
         message = message + ("Worker {0}: Test: {1} {2} [So far: total {3}, executed {4}, PASS {5}, FAIL {6}]\n"
                              .format (worker_num,
                                       os.path.basename (filename),
@@ -372,8 +600,10 @@ def do_worker (worker_num, args_dict):
 
 # ================================================================
 # For each ELF file, execute it in the RISC-V simulator
+# Returns (message, result) where result is a dict with at least
+# 'passed', 'timed_out' and 'cached' entries.
 
-def do_isa_test (worker_no, args_dict, full_filename):
+def do_isa_test (worker_no, args_dict, full_filename, timeout):
     message = ""
 
     (dirname, basename) = os.path.split (full_filename)
@@ -381,11 +611,32 @@ def do_isa_test (worker_no, args_dict, full_filename):
     # Construct the commands for sub-process execution
     command1 = [args_dict ['elf_to_hex_exe'], full_filename, "Mem.hex"]
 
-    command2 = [args_dict ['sim_path'], "+tohost", "+jtag_port=666{0}".format(worker_no)]
-    command2.append ("+vpi_port=777{0}".format(worker_no))
+    command2 = [args_dict ['sim_path'], "+tohost", "+jtag_port={0}".format (6660 + worker_no)]
+    command2.append ("+vpi_port={0}".format (7770 + worker_no))
     if (args_dict ['verbosity'] == 1): command2.append ("+v1")
     elif (args_dict ['verbosity'] == 2): command2.append ("+v2")
 
+    # Cache key; the per-worker port numbers do not affect the outcome
+    plusargs  = [x for x in command2 [1:]
+                 if not (x.startswith ("+jtag_port=") or x.startswith ("+vpi_port="))]
+    cache_key = hash_string ("\n".join ([args_dict ['sim_hash'], args_dict ['inputs_hash'],
+                                         hash_file (full_filename)]
+                                        + plusargs))
+    cache_entry = os.path.join (args_dict ['cache_path'], cache_key [:2], cache_key)
+
+    if (not args_dict ['force']) and os.path.isdir (cache_entry):
+        cached = cache_lookup (cache_entry)
+        if cached != None:
+            passed = cached ['passed']
+            log_filename = os.path.join (
+                args_dict ['logs_path'], "pass" if passed else "fail", basename + ".log")
+            message = message + ("    Cached: {0}\n".format (cache_entry))
+            message = message + ("    Writing log: {0}\n".format (log_filename))
+            copy_cached_files (cache_entry, log_filename)
+            result = {key: cached.get (key) for key in metric_keys}
+            result.update ({'passed': passed, 'timed_out': False, 'cached': True})
+            return (message, result)
+
     message = message + "    Exec:"
     for x in command1:
         message = message + (" {0}".format (x))
@@ -395,11 +646,23 @@ def do_isa_test (worker_no, args_dict, full_filename):
     for x in command2:
         message = message + (" {0}".format (x))
     message = message + ("\n")
+    message = message + ("    Timeout: {0:.0f} s\n".format (timeout))
 
     # Run command as a sub-process
-    completed_process1 = run_command (command1)
-    completed_process2 = run_command (command2)
-    passed = completed_process2.stdout.find ("PASS") != -1
+    t_start = time.monotonic ()
+    (stdout1, timed_out1, _)           = run_command (command1, timeout_elf_to_hex)
+    t_sim   = time.monotonic ()
+    (stdout2, timed_out2, peak_rss_kb) = run_command (command2, timeout)
+    t_end   = time.monotonic ()
+    timed_out = timed_out1 or timed_out2
+    passed    = (not timed_out) and (stdout2.find ("PASS") != -1)
+
+    result = extract_metrics (stdout2)
+    result ['wall']        = round (t_end - t_start, 3)
+    result ['sim_wall']    = round (t_end - t_sim, 3)
+    result ['peak_rss_kb'] = peak_rss_kb
+    if result ['cycles'] != None and result ['sim_wall'] > 0:
+        result ['khz'] = round (result ['cycles'] / result ['sim_wall'] / 1000, 3)
 
     # Save stdouts in log file
     log_filename = os.path.join (
@@ -407,8 +670,10 @@ def do_isa_test (worker_no, args_dict, full_filename):
     message = message + ("    Writing log: {0}\n".format (log_filename))
 
     fd = open (log_filename, 'w')
-    fd.write (completed_process1.stdout)
-    fd.write (completed_process2.stdout)
+    fd.write (stdout1)
+    fd.write (stdout2)
+    if timed_out:
+        fd.write ("\nTIMEOUT after {0:.0f} s\n".format (timeout_elf_to_hex if timed_out1 else timeout))
     fd.close ()
 
     # If Tandem Verification trace file was created, save it as well
@@ -417,31 +682,195 @@ def do_isa_test (worker_no, args_dict, full_filename):
         os.rename ("./trace_out.dat", trace_filename)
         message = message + ("    Trace output saved in: {0}\n".format (trace_filename))
 
-    return (message, passed)
+    # Timeouts depend on host load, so only completed runs are cached
+    if not timed_out:
+        cached = {key: result [key] for key in metric_keys}
+        cached.update ({'test': basename, 'passed': passed})
+        cache_store (cache_entry, cached, log_filename)
+
+    result.update ({'passed': passed, 'timed_out': timed_out, 'cached': False})
+    return (message, result)
 
 # ================================================================
-# This is a wrapper around 'subprocess.run' because of an annoying
-# incompatible change in moving from Python 3.5 to 3.6
-
-def run_command (command):
-    python_minor_version = sys.version_info [1]
-    if python_minor_version < 6:
-        # Python 3.5 and earlier
-        result = subprocess.run (args = command,
-                                 timeout = 30,
-                                 bufsize = 0,
-                                 stdout = subprocess.PIPE,
-                                 stderr = subprocess.STDOUT,
-                                 universal_newlines = True)
-    else:
-        # Python 3.6 and later
-        result = subprocess.run (args = command,
-                                 timeout = 30,
-                                 bufsize = 0,
-                                 stdout = subprocess.PIPE,
-                                 stderr = subprocess.STDOUT,
-                                 encoding='utf-8')
-    return result
+# Performance metrics of one simulation run.
+# 'cycles' and 'instret' come from the lines printed by sim_main.cpp at the
+# end of simulation; 'instret' (the core's minstret) is printed only for
+# processors whose Include.mk names it, and not by HIER=1 builds.
+
+metric_keys = ['wall', 'sim_wall', 'cycles', 'instret', 'khz', 'peak_rss_kb']
+
+re_cycles  = re.compile (r"^Simulated cycles: (\d+)", re.MULTILINE)
+re_instret = re.compile (r"^Retired instructions: (\d+)", re.MULTILINE)
+
+def extract_metrics (stdout):
+    metrics = {key: None for key in metric_keys}
+    m = re_cycles.search (stdout)
+    if m:
+        metrics ['cycles'] = int (m.group (1))
+    m = re_instret.search (stdout)
+    if m:
+        metrics ['instret'] = int (m.group (1))
+    return metrics
+
+# ================================================================
+# Summary of all results, with aggregates per ISA test family
+
+def test_family (test_families, basename):
+    for family in test_families:
+        if basename.find (family) != -1: return family
+    return "other"
+
+def make_summary (args_dict, all_results):
+    tests    = {}
+    families = {}
+    for basename in sorted (all_results):
+        result = dict (all_results [basename])
+        family = test_family (args_dict ['test_families'], basename)
+        result ['family'] = family
+        tests [basename]  = result
+
+        agg = families.setdefault (family, {'tests': 0, 'passed': 0, 'failed': 0,
+                                            'wall': 0.0, 'sim_wall': 0.0,
+                                            'cycles': 0, 'instret': 0,
+                                            'khz': None, 'peak_rss_kb': None})
+        agg ['tests'] = agg ['tests'] + 1
+        if result ['passed']:
+            agg ['passed'] = agg ['passed'] + 1
+        else:
+            agg ['failed'] = agg ['failed'] + 1
+        for key in ['wall', 'sim_wall', 'cycles', 'instret']:
+            if result.get (key) != None:
+                agg [key] = agg [key] + result [key]
+        if result.get ('peak_rss_kb') != None:
+            agg ['peak_rss_kb'] = max (agg ['peak_rss_kb'] or 0, result ['peak_rss_kb'])
+
+    for agg in families.values ():
+        agg ['wall']     = round (agg ['wall'], 3)
+        agg ['sim_wall'] = round (agg ['sim_wall'], 3)
+        if agg ['cycles'] > 0 and agg ['sim_wall'] > 0:
+            agg ['khz'] = round (agg ['cycles'] / agg ['sim_wall'] / 1000, 3)
+
+    return {'sim_path':    args_dict ['sim_path'],
+            'sim_hash':    args_dict ['sim_hash'],
+            'arch':        args_dict ['arch_string'],
+            'timestamp':   time.strftime ("%Y-%m-%dT%H:%M:%S%z"),
+            'tests':       tests,
+            'families':    families}
+
+def write_junit (path, summary):
+    root = xml.etree.ElementTree.Element ('testsuites')
+    for (family, agg) in sorted (summary ['families'].items ()):
+        suite = xml.etree.ElementTree.SubElement (
+            root, 'testsuite', name = family, tests = str (agg ['tests']),
+            failures = str (agg ['failed']), time = str (agg ['wall']))
+        for (basename, result) in sorted (summary ['tests'].items ()):
+            if result ['family'] != family: continue
+            case = xml.etree.ElementTree.SubElement (
+                suite, 'testcase', name = basename, classname = family,
+                time = str (result.get ('wall') or 0))
+            props = xml.etree.ElementTree.SubElement (case, 'properties')
+            for key in metric_keys + ['cached']:
+                if result.get (key) != None:
+                    xml.etree.ElementTree.SubElement (props, 'property',
+                                                      name = key, value = str (result [key]))
+            if result ['timed_out']:
+                xml.etree.ElementTree.SubElement (case, 'failure', message = "TIMEOUT")
+            elif not result ['passed']:
+                xml.etree.ElementTree.SubElement (case, 'failure', message = "FAIL")
+    xml.etree.ElementTree.ElementTree (root).write (path, encoding = 'utf-8',
+                                                    xml_declaration = True)
+
+# ================================================================
+# Result cache.  Each entry is a directory <cache>/<key[:2]>/<key>/
+# holding result.json, log, and (if one was produced) trace_data.
+
+def hash_file (path):
+    h = hashlib.sha256 ()
+    with open (path, 'rb') as fd:
+        for chunk in iter (lambda: fd.read (1 << 20), b''):
+            h.update (chunk)
+    return h.hexdigest ()
+
+def hash_string (s):
+    return hashlib.sha256 (s.encode ('utf-8')).hexdigest ()
+
+# procs/<proc>/boot_rom.bin and flash.bin, for a simulator named
+# exe_HW_<proc>_sim (the DPI_ROM=1 defaults, see ../Makefile)
+def default_rom_files (sim_path):
+    m = re.match (r"exe_HW_(\w+?)_sim", os.path.basename (sim_path))
+    if not m:
+        return []
+    procs_dir = os.path.join (os.path.dirname (os.path.abspath (__file__)), "..", "procs", m.group (1))
+    return [os.path.normpath (os.path.join (procs_dir, f)) for f in ("boot_rom.bin", "flash.bin")]
+
+def cache_lookup (cache_entry):
+    try:
+        with open (os.path.join (cache_entry, "result.json"), 'r') as fd:
+            result = json.load (fd)
+        if os.path.exists (os.path.join (cache_entry, "log")):
+            return result
+    except (OSError, ValueError):
+        pass
+    return None
+
+def copy_cached_files (cache_entry, log_filename):
+    shutil.copyfile (os.path.join (cache_entry, "log"), log_filename)
+    cached_trace = os.path.join (cache_entry, "trace_data")
+    if os.path.exists (cached_trace):
+        shutil.copyfile (cached_trace, log_filename.rsplit ('.', 1)[0] + ".trace_data")
+
+def cache_store (cache_entry, result, log_filename):
+    # Build the entry in a private directory, then rename it into place,
+    # so concurrent workers and interrupted runs never see a partial entry
+    tmp_entry = "{0}.tmp{1}".format (cache_entry, os.getpid ())
+    try:
+        os.makedirs (tmp_entry)
+        shutil.copyfile (log_filename, os.path.join (tmp_entry, "log"))
+        trace_filename = log_filename.rsplit ('.', 1)[0] + ".trace_data"
+        if os.path.exists (trace_filename):
+            shutil.copyfile (trace_filename, os.path.join (tmp_entry, "trace_data"))
+        with open (os.path.join (tmp_entry, "result.json"), 'w') as fd:
+            json.dump (result, fd)
+        if os.path.isdir (cache_entry):
+            shutil.rmtree (cache_entry)
+        os.rename (tmp_entry, cache_entry)
+    except OSError as e:
+        sys.stdout.write ("WARNING: could not store cache entry {0}: {1}\n".format (cache_entry, e))
+        shutil.rmtree (tmp_entry, ignore_errors = True)
+
+# ================================================================
+# Run command as a sub-process, collecting its output.
+# Returns (stdout, timed_out, peak_rss_kb); on timeout the process is
+# killed and whatever output it produced is returned.
+# The process is reaped with os.wait4 to obtain its own peak RSS
+# (getrusage (RUSAGE_CHILDREN) would give the maximum over all children).
+# Output goes to a temporary file rather than a pipe, so a chatty
+# simulator cannot block on a full pipe while we poll.
+
+def run_command (command, timeout):
+    with tempfile.TemporaryFile () as fd_out:
+        process  = subprocess.Popen (args = command,
+                                     stdout = fd_out,
+                                     stderr = subprocess.STDOUT)
+        deadline  = time.monotonic () + timeout
+        timed_out = False
+        while True:
+            (pid, status, rusage) = os.wait4 (process.pid, os.WNOHANG)
+            if pid != 0: break
+            if time.monotonic () > deadline:
+                process.kill ()
+                (pid, status, rusage) = os.wait4 (process.pid, 0)
+                timed_out = True
+                break
+            time.sleep (0.02)
+        # Tell Popen the process has been reaped
+        process.returncode = status
+
+        fd_out.seek (0)
+        stdout = fd_out.read ().decode ('utf-8', errors = 'replace')
+
+    # ru_maxrss is in kilobytes on Linux
+    return (stdout, timed_out, rusage.ru_maxrss)
 
 # ================================================================
 # For non-interactive invocations, call main() and use its return value
@@ -0,0 +1,273 @@
+#!/usr/bin/python3
+
+# Copyright (c) 2019 Bluespec, Inc.
+# See LICENSE for license details
+
+usage_line = (
+    "  Usage:\n"
+    "    $ <this_prog>    <opt flags>  <bbv_prefix>\n"
+    "\n"
+    "  Chooses simulation points (as SimPoint does) from the basic-block vectors\n"
+    "  written by a simulator built with \"make simulator PROC=<proc> BBV=1\" and\n"
+    "  run with +bbv +bbv_out=<bbv_prefix>: <bbv_prefix>.bb has one vector per\n"
+    "  interval of instructions, <bbv_prefix>.intervals the position and cycle\n"
+    "  count of each interval.\n"
+    "\n"
+    "  The vectors are normalized, randomly projected to a few dimensions and\n"
+    "  clustered by k-means, for each k up to --maxk; the smallest k whose BIC\n"
+    "  score reaches --bic of the range of scores is kept.  In each cluster, the\n"
+    "  (full-length) interval closest to the centroid is the simulation point;\n"
+    "  its weight is the cluster's share of all instructions.\n"
+    "\n"
+    "  Writes, in SimPoint's formats:\n"
+    "    <bbv_prefix>.simpoints  '<interval> <cluster>' per simulation point\n"
+    "    <bbv_prefix>.weights    '<weight> <cluster>' per simulation point\n"
+    "  and prints, and saves in <bbv_prefix>.report.txt, the points with their\n"
+    "  first instruction and cycle, weight and CPI, and the CPI they predict\n"
+    "  for the whole run against the measured one.\n"
+    "\n"
+    "  <opt flags> may be any of the following:\n"
+    "      --maxk=<n>            Largest number of clusters tried (default: {0})\n"
+    "      --dim=<n>             Dimensions of the projection (default: {1})\n"
+    "      --tries=<n>           k-means runs (different seeds) per k (default: {2})\n"
+    "      --bic=<f>             Fraction of the BIC range to reach (default: {3})\n"
+    "      --seed=<n>            Random seed (default: {4})\n"
+    "\n"
+    "  Example:\n"
+    "      $ <this_prog>  --maxk=20  Logs/bbv/bluespec_p2/bbv\n"
+)
+
+import sys
+import math
+import random
+
+from Run_regression import extract_flags
+
+maxk_default  = 10
+dim_default   = 15
+tries_default = 5
+bic_default   = 0.9
+seed_default  = 493575226
+
+max_iterations = 100
+
+# ================================================================
+
+def main (argv = None):
+    (flags, argv) = extract_flags (argv)
+    if ((len (argv) <= 1) or
+        (argv [1] == '-h') or (argv [1] == '--help')):
+
+        sys.stdout.write (usage_line.format (maxk_default, dim_default, tries_default,
+                                             bic_default, seed_default))
+        return 0
+
+    prefix = argv [1]
+    maxk   = int (flags.get ('maxk', maxk_default))
+    dim    = int (flags.get ('dim', dim_default))
+    tries  = int (flags.get ('tries', tries_default))
+    bic    = float (flags.get ('bic', bic_default))
+    seed   = int (flags.get ('seed', seed_default))
+
+    try:
+        vectors   = read_bb (prefix + ".bb")
+        intervals = read_intervals (prefix + ".intervals", vectors)
+    except OSError as e:
+        sys.stderr.write ("ERROR: cannot read {0}\n".format (e.filename))
+        return 1
+    if not vectors:
+        sys.stderr.write ("ERROR: no intervals in {0}.bb (is the TV port driven?)\n".format (prefix))
+        return 1
+
+    points = project (vectors, dim, seed)
+    rng    = random.Random (seed)
+    runs   = []
+    for k in range (1, min (maxk, len (points)) + 1):
+        best = None
+        for t in range (tries):
+            (assign, centroids, distortion) = kmeans (points, k, rng)
+            if (best is None) or (distortion < best [2]):
+                best = (assign, centroids, distortion)
+        runs.append (best + (bic_score (points, best [0], best [1], best [2]),))
+
+    scores = [r [3] for r in runs]
+    lo     = min (scores)
+    hi     = max (scores)
+    chosen = next (r for r in runs if r [3] >= lo + bic * (hi - lo))
+    (assign, centroids, distortion, score) = chosen
+
+    simpoints = choose_points (points, intervals, assign, centroids)
+
+    with open (prefix + ".simpoints", 'w') as fd:
+        for (c, j, w) in simpoints:
+            fd.write ("{0} {1}\n".format (j, c))
+    with open (prefix + ".weights", 'w') as fd:
+        for (c, j, w) in simpoints:
+            fd.write ("{0:.6f} {1}\n".format (w, c))
+
+    with open (prefix + ".report.txt", 'w') as fd:
+        for out in (sys.stdout, fd):
+            report (out, prefix, intervals, runs, chosen, simpoints)
+    return 0
+
+# ================================================================
+# Inputs
+
+# <prefix>.bb: one line per interval, "T:<id>:<count> :<id>:<count> ..."
+def read_bb (path):
+    vectors = []
+    with open (path, 'r') as fd:
+        for line in fd:
+            line = line.strip ()
+            if not line.startswith ('T'):
+                continue
+            v = {}
+            for field in line [1:].split ():
+                (_, bb, count) = field.split (':')
+                v [int (bb)] = int (count)
+            vectors.append (v)
+    return vectors
+
+# <prefix>.intervals: "<interval> <first_insn> <insns> <first_cycle> <cycles>";
+# if absent, intervals are measured from the vectors, without cycles
+def read_intervals (path, vectors):
+    intervals = []
+    try:
+        with open (path, 'r') as fd:
+            for line in fd:
+                fields = line.split ()
+                if fields and not fields [0].startswith ('#'):
+                    intervals.append (tuple (int (x) for x in fields [1:5]))
+    except OSError:
+        first = 0
+        for v in vectors:
+            n = sum (v.values ())
+            intervals.append ((first, n, None, None))
+            first += n
+    return intervals [:len (vectors)]
+
+# ================================================================
+# Clustering
+
+# Each vector, as fractions of its interval, times a random matrix with
+# entries in [-1, 1] (one row per basic block, drawn in order of id)
+def project (vectors, dim, seed):
+    rng  = random.Random (seed)
+    rows = {}
+    for bb in sorted (set (bb for v in vectors for bb in v)):
+        rows [bb] = [rng.uniform (-1.0, 1.0) for d in range (dim)]
+    points = []
+    for v in vectors:
+        total = float (sum (v.values ())) or 1.0
+        p     = [0.0] * dim
+        for (bb, count) in v.items ():
+            f = count / total
+            r = rows [bb]
+            for d in range (dim):
+                p [d] += f * r [d]
+        points.append (p)
+    return points
+
+def dist2 (a, b):
+    return sum ((x - y) * (x - y) for (x, y) in zip (a, b))
+
+# k-means, from k-means++ seeds; returns (cluster of each point, centroids,
+# sum of squared distances to the centroids)
+def kmeans (points, k, rng):
+    centroids = [list (rng.choice (points))]
+    while len (centroids) < k:
+        d = [min (dist2 (p, c) for c in centroids) for p in points]
+        total = sum (d)
+        if total == 0:
+            centroids.append (list (rng.choice (points)))
+            continue
+        x = rng.uniform (0, total)
+        for (p, dp) in zip (points, d):
+            x -= dp
+            if x <= 0:
+                break
+        centroids.append (list (p))
+
+    assign = None
+    for iteration in range (max_iterations):
+        new_assign = [min (range (k), key = lambda c: dist2 (p, centroids [c])) for p in points]
+        if new_assign == assign:
+            break
+        assign = new_assign
+        for c in range (k):
+            members = [p for (p, a) in zip (points, assign) if a == c]
+            if members:
+                centroids [c] = [sum (xs) / len (members) for xs in zip (*members)]
+
+    distortion = sum (dist2 (p, centroids [a]) for (p, a) in zip (points, assign))
+    return (assign, centroids, distortion)
+
+# Bayesian information criterion of a clustering, for spherical Gaussian
+# clusters of equal variance (Pelleg and Moore, as used by SimPoint)
+def bic_score (points, assign, centroids, distortion):
+    r = len (points)
+    k = len (centroids)
+    d = len (points [0])
+    variance = max (distortion / max (r - k, 1) / d, 1e-12)
+    loglik   = 0.0
+    for c in range (k):
+        n = assign.count (c)
+        if n == 0:
+            continue
+        loglik += (n * math.log (n / r)
+                   - n * d / 2.0 * math.log (2 * math.pi * variance)
+                   - (n - 1) * d / 2.0)
+    params = k * (d + 1)
+    return loglik - params / 2.0 * math.log (r)
+
+# For each non-empty cluster: (cluster, interval nearest its centroid,
+# cluster's share of instructions).  A partial interval (the last one) is
+# chosen only if the cluster has no full one.
+def choose_points (points, intervals, assign, centroids):
+    full   = max (iv [1] for iv in intervals)
+    total  = float (sum (iv [1] for iv in intervals)) or 1.0
+    result = []
+    for c in range (len (centroids)):
+        members = [j for j in range (len (points)) if assign [j] == c]
+        if not members:
+            continue
+        candidates = [j for j in members if intervals [j][1] == full] or members
+        best = min (candidates, key = lambda j: dist2 (points [j], centroids [c]))
+        result.append ((c, best, sum (intervals [j][1] for j in members) / total))
+    return result
+
+# ================================================================
+# Report
+
+def report (out, prefix, intervals, runs, chosen, simpoints):
+    n_insns = sum (iv [1] for iv in intervals)
+    out.write ("Simulation points for {0}: {1} intervals, {2} instructions\n"
+               .format (prefix, len (intervals), n_insns))
+    out.write ("\n  k  BIC\n")
+    for r in runs:
+        out.write ("{0:3d}  {1:.1f}{2}\n".format (len (r [1]), r [3], "  <=" if r is chosen else ""))
+
+    out.write ("\n  interval  cluster   first insn    first cycle  weight     CPI\n")
+    has_cycles = all (iv [2] is not None for iv in intervals)
+    estimate   = 0.0
+    for (c, j, w) in sorted (simpoints, key = lambda s: s [1]):
+        (first, insns, cycle, cycles) = intervals [j]
+        if has_cycles and insns:
+            cpi = cycles / float (insns)
+            estimate += w * cpi
+            out.write ("{0:10d} {1:8d} {2:12d} {3:14d}  {4:6.4f}  {5:6.3f}\n".format (j, c, first, cycle, w, cpi))
+        else:
+            out.write ("{0:10d} {1:8d} {2:12d} {3:>14}  {4:6.4f}\n".format (j, c, first, "-", w))
+
+    if has_cycles and n_insns:
+        measured = sum (iv [3] for iv in intervals) / float (n_insns)
+        out.write ("\nCPI: {0:.4f} estimated from the simulation points, {1:.4f} measured ({2:+.2f}%)\n"
+                   .format (estimate, measured, 100.0 * (estimate - measured) / measured))
+    out.write ("\nA point can be simulated on its own from its first instruction, e.g. with\n"
+               "\"make run_hybrid HYBRID_STOP=--insns=<first insn>\" (Spike up to there).\n")
+
+# ================================================================
+# For non-interactive invocations, call main() and use its return value
+# as the exit code.
+if __name__ == '__main__':
+  sys.exit (main (sys.argv))
@@ -185,6 +185,10 @@ int main( int argc, char* argv[] )
   int results_data_r[DATA_SIZE][DATA_SIZE];
   int results_data_g[DATA_SIZE][DATA_SIZE];
   int results_data_b[DATA_SIZE][DATA_SIZE];
+  uint64_t cycles0, instret0;
+
+  cycles0  = read_cycle ();
+  instret0 = read_instret ();
 
   for (i = 0; i < DATA_SIZE; i++)
   {
@@ -192,6 +196,8 @@ int main( int argc, char* argv[] )
                 results_data_r, results_data_g, results_data_b);
   }
 
+  print_bench ("filters", read_cycle () - cycles0, read_instret () - instret0);
+
   // Check the results
 
   resr = verify(results_data_r, verify_data_r);
@@ -0,0 +1,195 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// heaptest: checks the heap of lib/bare.lds and lib/syscalls.c, and the
+// arena allocator of lib/arena.c.
+//
+//     layout   __heap_start is 16-byte aligned, above the end of the image
+//              (_end) and below __heap_end
+//     _sbrk    grows the break up to exactly __heap_end, fails with
+//              ENOMEM (and returns -1) beyond it, and shrinks back, but
+//              not below __heap_start
+//     malloc   returns memory inside the heap
+//     arena    results are ARENA_ALIGN-aligned, bump allocation stops at
+//              the limit, size classes recycle freed blocks of the same
+//              class only, blocks above ARENA_MAX_CLASS_BYTES are not
+//              recycled, and arena_reset () empties the arena and its
+//              free lists
+//
+// While the heap is exhausted nothing is printed (stdio may allocate);
+// failures are recorded and printed afterwards.
+// ================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#include "riscv_counters.h"
+#include "arena.h"
+
+extern void *_sbrk (int nbytes);
+
+// From the linker (bare.lds)
+extern char _end [], __heap_start [], __heap_end [];
+
+#define MAX_FAILURES  32
+
+static int          n_checks = 0;
+static int          n_failures = 0;
+static int          failed_lines [MAX_FAILURES];
+static const char  *failed_exprs [MAX_FAILURES];
+
+#define CHECK(cond) check ((cond), __LINE__, #cond)
+
+static void check (int ok, int line, const char *expr)
+{
+    n_checks++;
+    if (ok)
+	return;
+    if (n_failures < MAX_FAILURES) {
+	failed_lines [n_failures] = line;
+	failed_exprs [n_failures] = expr;
+    }
+    n_failures++;
+}
+
+static int aligned (const void *p, uintptr_t align)
+{
+    return ((uintptr_t) p & (align - 1)) == 0;
+}
+
+// ================================================================
+
+static void check_layout (void)
+{
+    CHECK (aligned (__heap_start, 16));
+    CHECK (__heap_start >= _end);
+    CHECK (__heap_start < __heap_end);
+}
+
+static void check_sbrk (void)
+{
+    char *brk0 = _sbrk (0);
+    char *p;
+    int   room;
+
+    CHECK ((brk0 >= __heap_start) && (brk0 <= __heap_end));
+
+    p = _sbrk (64);
+    CHECK (p == brk0);
+    CHECK (_sbrk (0) == brk0 + 64);
+
+    // Up to the end, exactly
+    room = __heap_end - brk0 - 64;
+    p = _sbrk (room);
+    CHECK (p == brk0 + 64);
+    CHECK (_sbrk (0) == __heap_end);
+
+    // Beyond it
+    errno = 0;
+    CHECK (_sbrk (1) == (void *) -1);
+    CHECK (errno == ENOMEM);
+    CHECK (_sbrk (0) == __heap_end);
+
+    // Back down, but not below the start
+    p = _sbrk (- (room + 64));
+    CHECK (p == __heap_end);
+    CHECK (_sbrk (0) == brk0);
+    errno = 0;
+    CHECK (_sbrk (- (int) (brk0 - __heap_start) - 1) == (void *) -1);
+    CHECK (errno == ENOMEM);
+    CHECK (_sbrk (0) == brk0);
+}
+
+static void check_malloc (void)
+{
+    char *p = malloc (1000);
+
+    CHECK (p != NULL);
+    CHECK ((p >= __heap_start) && (p + 1000 <= __heap_end));
+    free (p);
+}
+
+// ================================================================
+
+static void check_arena (void)
+{
+    static char  buf [256];
+    arena_t      a;
+    char        *p, *q, *r, *big;
+
+    // Caller-supplied, misaligned memory
+    arena_init (& a, buf + 3, sizeof (buf) - 3);
+    CHECK (aligned (a.base, ARENA_ALIGN));
+    CHECK (a.base >= buf + 3);
+    CHECK (a.limit == buf + sizeof (buf));
+
+    // Bump allocation: rounded up to ARENA_ALIGN, NULL at the limit
+    p = arena_alloc (& a, 1);
+    q = arena_alloc (& a, ARENA_ALIGN + 1);
+    CHECK (p == a.base);
+    CHECK (q == p + ARENA_ALIGN);
+    CHECK (arena_used (& a) == 3 * ARENA_ALIGN);
+    CHECK (arena_alloc (& a, sizeof (buf)) == NULL);
+    CHECK (arena_used (& a) == 3 * ARENA_ALIGN);
+
+    arena_reset (& a);
+    CHECK (arena_used (& a) == 0);
+    CHECK (arena_alloc (& a, 1) == a.base);
+
+    // From the heap, with room for one block larger than the largest
+    // class, not two
+    CHECK (arena_init_sbrk (& a, ARENA_MAX_CLASS_BYTES + 1024) == 0);
+    CHECK ((a.base >= __heap_start) && (a.limit <= __heap_end));
+    CHECK (aligned (a.base, ARENA_ALIGN));
+
+    // Size classes: a freed block comes back for a request of the same
+    // class (20 and 30 bytes are both in the 32-byte class), not another
+    p = arena_alloc_class (& a, 20);
+    CHECK (aligned (p, ARENA_ALIGN));
+    arena_free_class (& a, p, 20);
+    CHECK (arena_alloc_class (& a, 64) != p);
+    CHECK (arena_alloc_class (& a, 30) == p);
+    q = arena_alloc_class (& a, 20);
+    CHECK ((q != NULL) && (q != p));
+
+    // Too large for any class: bump-allocated, never recycled
+    big = arena_alloc_class (& a, ARENA_MAX_CLASS_BYTES + 1);
+    CHECK ((big != NULL) && aligned (big, ARENA_ALIGN));
+    arena_free_class (& a, big, ARENA_MAX_CLASS_BYTES + 1);
+    r = arena_alloc_class (& a, ARENA_MAX_CLASS_BYTES + 1);
+    CHECK (r != big);
+    CHECK (r == NULL);    // the arena has no room for a second one
+
+    // arena_reset () empties the free lists: q is not handed out again
+    arena_free_class (& a, q, 20);
+    arena_reset (& a);
+    CHECK (arena_alloc_class (& a, 20) == a.base);
+    CHECK (arena_alloc_class (& a, 20) == a.base + 32);
+}
+
+// ================================================================
+
+int main (int argc, char *argv[])
+{
+    int j;
+
+    check_layout ();
+    check_sbrk ();
+    check_malloc ();
+    check_arena ();
+
+    printf ("heaptest: image end %p, heap %p .. %p\n", _end, __heap_start, __heap_end);
+    for (j = 0; (j < n_failures) && (j < MAX_FAILURES); j++)
+	printf ("heaptest: line %d: check failed: %s\n", failed_lines [j], failed_exprs [j]);
+    printf ("heaptest: %d checks, %d failed\n", n_checks, n_failures);
+
+    if (n_failures == 0) {
+	TEST_PASS
+    }
+    else {
+	TEST_FAIL
+    }
+    return 0;
+}
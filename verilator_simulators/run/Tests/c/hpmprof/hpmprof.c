@@ -0,0 +1,183 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// hpmprof: hardware performance-monitor profile of a few small kernels.
+//
+// Prints what HPM counters and events the core implements (hpm_discover),
+// then runs each kernel once per group of events (as many events per
+// group as there are counters), printing HPM lines (see lib/hpm.h).
+// Feed the console log to Hpm_report.py in the run directory for cache
+// miss, branch misprediction and stall breakdowns.  On a core without
+// HPM events, only cycles and instret are reported.
+// ================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "riscv_counters.h"
+#include "hpm.h"
+
+#ifndef WORKING_SET_KB
+#define WORKING_SET_KB  64
+#endif
+
+#define N_WORDS  ((WORKING_SET_KB * 1024) / sizeof (unsigned long))
+
+static unsigned long *buf;
+
+volatile unsigned long sink;
+
+// The events Hpm_report.py uses for its breakdowns
+static const char *profile_events [] = {
+    "load", "store", "branch", "jalr",
+    "icache_miss", "dcache_miss", "itlb_miss", "dtlb_miss",
+    "branch_mispredict", "target_mispredict",
+    "load_use_interlock", "long_latency_interlock", "csr_interlock",
+    "icache_blocked", "dcache_blocked", "muldiv_interlock", "fp_interlock",
+};
+
+#define N_PROFILE_EVENTS  (sizeof (profile_events) / sizeof (profile_events [0]))
+
+// ================================================================
+// Kernels
+
+static uint32_t rand_state = 0x2545F491;
+
+static uint32_t rand32 (void)
+{
+    uint32_t x = rand_state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rand_state = x;
+    return x;
+}
+
+static void stream (void)
+{
+    unsigned long j, sum = 0;
+
+    for (j = 0; j < N_WORDS; j++)
+	sum += buf [j];
+    for (j = 0; j < N_WORDS; j++)
+	buf [j] = sum + j;
+    sink = sum;
+}
+
+// One random cycle through the working set, 64 bytes per step
+static void chase_init (void)
+{
+    const unsigned long stride = 64 / sizeof (unsigned long);
+    const unsigned long n = N_WORDS / stride;
+    unsigned long j, k, t;
+
+    for (j = 0; j < n; j++)
+	buf [j * stride] = j;
+    for (j = n - 1; j > 0; j--) {
+	k = rand32 () % j;
+	t = buf [j * stride]; buf [j * stride] = buf [k * stride]; buf [k * stride] = t;
+    }
+    for (j = 0; j < n; j++)
+	buf [j * stride] = (unsigned long) & buf [buf [j * stride] * stride];
+}
+
+static void chase (void)
+{
+    unsigned long *p = buf;
+    unsigned long  j;
+
+    for (j = 0; j < N_WORDS / 8; j++)
+	p = (unsigned long *) *p;
+    sink = (unsigned long) p;
+}
+
+// Data-dependent branches on random bits
+static void branchy (void)
+{
+    unsigned long j, count = 0;
+
+    for (j = 0; j < 4096; j++) {
+	uint32_t x = rand32 ();
+	if (x & 1)
+	    count += 3;
+	if (x & 2)
+	    count ^= j;
+	else
+	    count += x >> 28;
+    }
+    sink = count;
+}
+
+static void muldiv (void)
+{
+    unsigned long j, x = 12345;
+
+    for (j = 1; j < 2048; j++)
+	x = (x * 2654435761UL) / j + 7;
+    sink = x;
+}
+
+typedef struct {
+    const char *name;
+    void      (*init) (void);
+    void      (*run)  (void);
+} kernel_t;
+
+static void stream_init (void)
+{
+    unsigned long j;
+
+    for (j = 0; j < N_WORDS; j++)
+	buf [j] = j;
+}
+
+static const kernel_t kernels [] = {
+    {"stream",  stream_init, stream},
+    {"chase",   chase_init,  chase},
+    {"branchy", NULL,        branchy},
+    {"muldiv",  NULL,        muldiv},
+};
+
+#define N_KERNELS  (sizeof (kernels) / sizeof (kernels [0]))
+
+// ================================================================
+
+int main (int argc, char *argv[])
+{
+    int          n_counters, k, first, n;
+    hpm_region_t r;
+
+    buf = malloc (N_WORDS * sizeof (unsigned long));
+    if (buf == NULL) {
+	printf ("hpmprof: cannot allocate %d KiB\n", WORKING_SET_KB);
+	TEST_FAIL
+	return 1;
+    }
+
+    hpm_discover ();
+    n_counters = hpm_num_counters ();
+
+    for (k = 0; k < (int) N_KERNELS; k++) {
+	first = 0;
+	do {
+	    n = (n_counters < (int) N_PROFILE_EVENTS - first) ? n_counters : (int) N_PROFILE_EVENTS - first;
+
+	    if (kernels [k].init != NULL)
+		kernels [k].init ();
+	    kernels [k].run ();    // warm-up
+
+	    hpm_region_init (& r, kernels [k].name, & profile_events [first], n);
+	    hpm_region_start (& r);
+	    kernels [k].run ();
+	    hpm_region_stop (& r);
+	    hpm_region_report (& r);
+
+	    first += n;
+	} while ((n > 0) && (first < (int) N_PROFILE_EVENTS));
+    }
+
+    TEST_PASS
+    return 0;
+}
@@ -21,6 +21,8 @@ int main (int argc, char *argv[])
     uint32_t j, op, shamt, noop;
     uint32_t u32a, u32b, result32, exp32;
     uint64_t u64a, u64b, result64, exp64;
+    uint64_t cycles0  = read_cycle ();
+    uint64_t instret0 = read_instret ();
 
     for (j = 0; j < N; j++) {
 	op    = test_data32 [j][0];
@@ -68,6 +70,8 @@ int main (int argc, char *argv[])
         verify_64_ok = 1;
     }
 
+    print_bench ("intOpsTest", read_cycle () - cycles0, read_instret () - instret0);
+
     if ((verify_32_ok == 1) && (verify_64_ok == 1)) {
         TEST_PASS
     } else {
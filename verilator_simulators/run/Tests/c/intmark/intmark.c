@@ -0,0 +1,456 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// intmark: a CoreMark-class integer workload.
+//
+// Like EEMBC CoreMark, each iteration exercises four kernels whose
+// results are folded into a CRC-16, so that nothing can be optimized
+// away and the final CRC checks correct execution:
+//     - linked list: find, reverse, merge-sort by value and by index
+//     - matrix:      add/multiply by constant, matrix*vector,
+//                    matrix*matrix, and bit-field extraction (int16/int32)
+//     - state machine: classify the numeric tokens of a comma-separated
+//                    string, with and without corrupted characters
+//     - CRC-16 of all of the above
+// It is a reimplementation with the same kernel mix, not CoreMark, and its
+// scores are not CoreMark scores.
+//
+// All data are fixed-width integers, so the CRC is the same on RV32
+// and RV64.  Build with -DITERATIONS=<n> to change the run length
+// (the expected CRC below is for the default).
+// ================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "riscv_counters.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS  10
+#define EXPECTED_CRC  0x2a84
+#endif
+
+#define LIST_SIZE   64
+#define MAT_N       12
+
+// Seeds are volatile so that the compiler cannot precompute the kernels
+volatile int16_t seed_1 = 0x3415;
+volatile int16_t seed_2 = 0x3415;
+volatile int16_t seed_3 = 0x0066;
+
+// ================================================================
+// CRC-16 (reflected polynomial 0xA001, as in CoreMark)
+
+static uint16_t crc8 (uint8_t data, uint16_t crc)
+{
+    int i;
+
+    crc ^= data;
+    for (i = 0; i < 8; i++)
+	crc = (crc & 1) ? ((crc >> 1) ^ 0xA001) : (crc >> 1);
+    return crc;
+}
+
+static uint16_t crc16 (uint16_t data, uint16_t crc)
+{
+    crc = crc8 ((uint8_t) data,        crc);
+    crc = crc8 ((uint8_t) (data >> 8), crc);
+    return crc;
+}
+
+static uint16_t crc32 (uint32_t data, uint16_t crc)
+{
+    crc = crc16 ((uint16_t) data,         crc);
+    crc = crc16 ((uint16_t) (data >> 16), crc);
+    return crc;
+}
+
+// ================================================================
+// Linked list kernel
+
+typedef struct node_s {
+    struct node_s *next;
+    int16_t        data;
+    int16_t        idx;
+} node_t;
+
+static node_t list_pool [LIST_SIZE];
+
+static node_t *list_init (int16_t seed)
+{
+    int      j;
+    uint16_t x = (uint16_t) seed;
+
+    for (j = 0; j < LIST_SIZE; j++) {
+	x = (uint16_t) (x * 25173 + 13849);
+	list_pool [j].data = (int16_t) (x & 0x7fff);
+	list_pool [j].idx  = (int16_t) j;
+	list_pool [j].next = (j + 1 < LIST_SIZE) ? (& list_pool [j + 1]) : NULL;
+    }
+    return & list_pool [0];
+}
+
+static node_t *list_reverse (node_t *list)
+{
+    node_t *prev = NULL;
+
+    while (list != NULL) {
+	node_t *next = list->next;
+	list->next = prev;
+	prev = list;
+	list = next;
+    }
+    return prev;
+}
+
+static node_t *list_find (node_t *list, int16_t data)
+{
+    while ((list != NULL) && ((list->data & 0xff) != data))
+	list = list->next;
+    return list;
+}
+
+// Bottom-up merge sort, on 'data' if by_data, else on 'idx'
+
+static int node_cmp (node_t *a, node_t *b, int by_data)
+{
+    return by_data ? (a->data - b->data) : (a->idx - b->idx);
+}
+
+static node_t *list_mergesort (node_t *list, int by_data)
+{
+    node_t *p, *q, *e, *tail;
+    int     insize = 1, nmerges, psize, qsize, j;
+
+    while (1) {
+	p    = list;
+	list = NULL;
+	tail = NULL;
+	nmerges = 0;
+	while (p != NULL) {
+	    nmerges++;
+	    q = p;
+	    psize = 0;
+	    for (j = 0; j < insize; j++) {
+		psize++;
+		q = q->next;
+		if (q == NULL) break;
+	    }
+	    qsize = insize;
+	    while ((psize > 0) || ((qsize > 0) && (q != NULL))) {
+		if (psize == 0) {
+		    e = q; q = q->next; qsize--;
+		} else if ((qsize == 0) || (q == NULL)) {
+		    e = p; p = p->next; psize--;
+		} else if (node_cmp (p, q, by_data) <= 0) {
+		    e = p; p = p->next; psize--;
+		} else {
+		    e = q; q = q->next; qsize--;
+		}
+		if (tail != NULL)
+		    tail->next = e;
+		else
+		    list = e;
+		tail = e;
+	    }
+	    p = q;
+	}
+	tail->next = NULL;
+	if (nmerges <= 1)
+	    return list;
+	insize *= 2;
+    }
+}
+
+static uint16_t bench_list (node_t **plist, int16_t finder, uint16_t crc)
+{
+    node_t  *list = *plist;
+    node_t  *n;
+    int16_t  j;
+    uint16_t found = 0, missed = 0;
+
+    for (j = 0; j < 16; j++) {
+	n = list_find (list, (int16_t) ((finder + j * 37) & 0xff));
+	if (n != NULL) {
+	    found++;
+	    crc = crc16 ((uint16_t) n->idx, crc);
+	}
+	else
+	    missed++;
+	list = list_reverse (list);
+    }
+    crc = crc16 (found, crc);
+    crc = crc16 (missed, crc);
+
+    list = list_mergesort (list, 1);
+    for (n = list; n != NULL; n = n->next)
+	crc = crc16 ((uint16_t) n->data, crc);
+
+    // Perturb one value, so that every iteration sorts different data
+    list->next->data ^= (int16_t) (finder & 0x7ff);
+
+    list = list_mergesort (list, 0);
+    for (n = list, j = 0; n != NULL; n = n->next, j++)
+	if (n->idx != j) crc = crc16 (0xdead, crc);
+
+    *plist = list;
+    return crc;
+}
+
+// ================================================================
+// Matrix kernel
+
+static int16_t mat_a [MAT_N][MAT_N];
+static int16_t mat_b [MAT_N][MAT_N];
+static int32_t mat_c [MAT_N][MAT_N];
+
+static void matrix_init (int16_t seed)
+{
+    int      i, j;
+    uint16_t x = (uint16_t) seed;
+
+    for (i = 0; i < MAT_N; i++)
+	for (j = 0; j < MAT_N; j++) {
+	    x = (uint16_t) (x * 31421 + 6927);
+	    mat_a [i][j] = (int16_t) ((x >> 4) & 0x0fff);
+	    x = (uint16_t) (x * 31421 + 6927);
+	    mat_b [i][j] = (int16_t) (((x >> 4) & 0x0fff) - 0x0800);
+	}
+}
+
+static uint16_t matrix_crc (uint16_t crc)
+{
+    int      i, j;
+    uint32_t sum = 0;
+
+    for (i = 0; i < MAT_N; i++)
+	for (j = 0; j < MAT_N; j++) {
+	    sum += (uint32_t) mat_c [i][j];
+	    if (mat_c [i][j] > 0x10000)
+		crc = crc16 ((uint16_t) (i * MAT_N + j), crc);
+	}
+    return crc32 ((uint32_t) sum, crc);
+}
+
+static uint16_t bench_matrix (int16_t val, uint16_t crc)
+{
+    int i, j, k;
+
+    // A += val; C = A * val
+    for (i = 0; i < MAT_N; i++)
+	for (j = 0; j < MAT_N; j++) {
+	    mat_a [i][j] += val;
+	    mat_c [i][j] = (int32_t) mat_a [i][j] * val;
+	}
+    crc = matrix_crc (crc);
+
+    // C[i][0] = A * B[.][0]
+    for (i = 0; i < MAT_N; i++) {
+	int32_t acc = 0;
+	for (j = 0; j < MAT_N; j++)
+	    acc += (int32_t) mat_a [i][j] * mat_b [j][0];
+	for (j = 0; j < MAT_N; j++)
+	    mat_c [i][j] = acc;
+    }
+    crc = matrix_crc (crc);
+
+    // C = A * B
+    for (i = 0; i < MAT_N; i++)
+	for (j = 0; j < MAT_N; j++) {
+	    int32_t acc = 0;
+	    for (k = 0; k < MAT_N; k++)
+		acc += (int32_t) mat_a [i][k] * mat_b [k][j];
+	    mat_c [i][j] = acc;
+	}
+    crc = matrix_crc (crc);
+
+    // C = bit fields of (A * B), multiplied
+    for (i = 0; i < MAT_N; i++)
+	for (j = 0; j < MAT_N; j++) {
+	    int32_t acc = 0;
+	    for (k = 0; k < MAT_N; k++) {
+		int32_t t = (int32_t) mat_a [i][k] * mat_b [k][j];
+		acc += ((t >> 2) & 0xf) * ((t >> 5) & 0x7f);
+	    }
+	    mat_c [i][j] = acc;
+	}
+    crc = matrix_crc (crc);
+
+    // Restore A
+    for (i = 0; i < MAT_N; i++)
+	for (j = 0; j < MAT_N; j++)
+	    mat_a [i][j] -= val;
+
+    return crc;
+}
+
+// ================================================================
+// State machine kernel
+
+typedef enum {
+    S_START, S_INVALID, S_S1, S_INT, S_FLOAT, S_S2, S_EXPONENT, S_SCIENTIFIC, N_STATES
+} state_t;
+
+static const char *tokens [] = {
+    "5012",     "1234",     "-874",     "+122",
+    "35.54400", ".1234500", "-110.700", "+0.64400",
+    "5.500e+3", "-.123e-2", "-87e+832", "+0.6e-12",
+    "T0.3e-1F", "-T.T++Tq", "1T3.4e4z", "34.0e-T^"
+};
+
+#define N_TOKENS     (sizeof (tokens) / sizeof (tokens [0]))
+#define STATE_INPUT  256
+
+static uint8_t state_input [STATE_INPUT];
+
+static void state_init (int16_t seed)
+{
+    unsigned j = 0, t = (uint16_t) seed;
+    const char *p;
+
+    while (1) {
+	p = tokens [t % N_TOKENS];
+	t = t * 7 + 3;
+	if (j + 9 >= STATE_INPUT) break;
+	while (*p) state_input [j++] = (uint8_t) *p++;
+	state_input [j++] = ',';
+    }
+    while (j < STATE_INPUT)
+	state_input [j++] = 0;
+    state_input [STATE_INPUT - 1] = 0;
+}
+
+static int is_digit (uint8_t c) { return (c >= '0') && (c <= '9'); }
+
+// Scan one token starting at *pp; return its final state
+static state_t state_transition (uint8_t **pp, uint32_t *transitions)
+{
+    uint8_t *p = *pp;
+    state_t  state = S_START;
+
+    for (; (*p != 0) && (state != S_INVALID); p++) {
+	uint8_t c = *p;
+	if (c == ',') { p++; break; }
+	switch (state) {
+	case S_START:
+	    if (is_digit (c))                  state = S_INT;
+	    else if ((c == '+') || (c == '-')) state = S_S1;
+	    else if (c == '.')                 state = S_FLOAT;
+	    else { state = S_INVALID; transitions [S_INVALID]++; }
+	    transitions [S_START]++;
+	    break;
+	case S_S1:
+	    if (is_digit (c))  { state = S_INT;   transitions [S_S1]++; }
+	    else if (c == '.') { state = S_FLOAT; transitions [S_S1]++; }
+	    else               { state = S_INVALID; transitions [S_S1]++; }
+	    break;
+	case S_INT:
+	    if (c == '.')            { state = S_FLOAT;   transitions [S_INT]++; }
+	    else if (! is_digit (c)) { state = S_INVALID; transitions [S_INT]++; }
+	    break;
+	case S_FLOAT:
+	    if ((c == 'E') || (c == 'e')) { state = S_S2;      transitions [S_FLOAT]++; }
+	    else if (! is_digit (c))      { state = S_INVALID; transitions [S_FLOAT]++; }
+	    break;
+	case S_S2:
+	    if ((c == '+') || (c == '-')) { state = S_EXPONENT; transitions [S_S2]++; }
+	    else                          { state = S_INVALID;  transitions [S_S2]++; }
+	    break;
+	case S_EXPONENT:
+	    if (is_digit (c)) { state = S_SCIENTIFIC; transitions [S_EXPONENT]++; }
+	    else              { state = S_INVALID;    transitions [S_EXPONENT]++; }
+	    break;
+	case S_SCIENTIFIC:
+	    if (! is_digit (c)) { state = S_INVALID; transitions [S_INVALID]++; }
+	    break;
+	default:
+	    break;
+	}
+    }
+    // Skip the rest of an invalid token
+    while ((*p != 0) && (p [-1] != ','))
+	p++;
+    *pp = p;
+    return state;
+}
+
+static uint16_t state_scan (uint16_t crc)
+{
+    uint32_t final_counts [N_STATES] = {0};
+    uint32_t transitions  [N_STATES] = {0};
+    uint8_t *p = state_input;
+    int      j;
+
+    while (*p != 0)
+	final_counts [state_transition (& p, transitions)]++;
+
+    for (j = 0; j < N_STATES; j++) {
+	crc = crc32 (final_counts [j], crc);
+	crc = crc32 (transitions  [j], crc);
+    }
+    return crc;
+}
+
+static uint16_t bench_state (int16_t step, uint16_t crc)
+{
+    int j;
+
+    if (step < 1) step = 1;
+
+    crc = state_scan (crc);
+
+    // Corrupt every step'th character, scan again, and restore
+    for (j = 0; j < STATE_INPUT - 1; j += step)
+	if (state_input [j] != ',') state_input [j] ^= 0x20;
+    crc = state_scan (crc);
+    for (j = 0; j < STATE_INPUT - 1; j += step)
+	if (state_input [j] != ',') state_input [j] ^= 0x20;
+
+    return crc;
+}
+
+// ================================================================
+
+int main (int argc, char *argv[])
+{
+    node_t   *list;
+    uint16_t  crc = 0;
+    int       iter;
+    uint64_t  cycles, instret;
+
+    list = list_init (seed_1);
+    matrix_init (seed_2);
+    state_init (seed_3);
+
+    cycles  = read_cycle ();
+    instret = read_instret ();
+
+    for (iter = 0; iter < ITERATIONS; iter++) {
+	uint16_t crc_iter = 0;
+	crc_iter = bench_list   (& list, (int16_t) (seed_1 + iter), crc_iter);
+	crc_iter = bench_matrix ((int16_t) (seed_3 + iter), crc_iter);
+	crc_iter = bench_state  ((int16_t) ((iter % 7) + 3), crc_iter);
+	crc = crc16 (crc_iter, crc);
+    }
+
+    cycles  = read_cycle ()   - cycles;
+    instret = read_instret () - instret;
+
+    print_bench ("intmark", cycles, instret);
+    if (cycles != 0)
+	printf ("intmark: %d iterations, %llu iterations per Gcycle, crc 0x%04x\n",
+		ITERATIONS,
+		(unsigned long long) (((uint64_t) ITERATIONS * 1000000000) / cycles),
+		crc);
+
+#ifdef EXPECTED_CRC
+    if (crc != EXPECTED_CRC) {
+	printf ("Verify: not ok (expected crc 0x%04x)\n", EXPECTED_CRC);
+	TEST_FAIL
+	return 1;
+    }
+    printf ("Verify: ok\n");
+#endif
+    TEST_PASS
+    return 0;
+}
@@ -0,0 +1,317 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// kernels: small Embench-style benchmark kernels.
+//
+// Each kernel is a self-contained integer workload with a known checksum:
+//     crc32        bitwise CRC-32 over a 1 KiB buffer
+//     matmult_int  20x20 int32 matrix multiply (as in Embench matmult-int)
+//     fir          32-tap int16 FIR filter over 256 samples (as in Embench edn)
+//     qsort        iterative quicksort of 256 uint32
+//     bitcount     three bit-counting methods over 1024 words (as in MiBench)
+// Each kernel is run once untimed (to warm caches and branch predictors)
+// and then timed, and reported in its own BENCH line (see riscv_counters.h).
+//
+// All data are fixed-width integers, so the checksums are the same on
+// RV32 and RV64.  Build with -DREPEAT=<n> to change the number of times
+// each kernel is repeated per timed run (checksums are per repetition).
+// ================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "riscv_counters.h"
+
+#ifndef REPEAT
+#define REPEAT  4
+#endif
+
+// ================================================================
+// Pseudo-random data (xorshift32), so that inputs do not depend on libc
+
+static uint32_t rand_state;
+
+static uint32_t rand32 (void)
+{
+    uint32_t x = rand_state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rand_state = x;
+    return x;
+}
+
+// ================================================================
+// crc32
+
+#define CRC_BYTES  1024
+
+static uint8_t crc_buf [CRC_BYTES];
+
+static void init_crc32 (void)
+{
+    int j;
+
+    for (j = 0; j < CRC_BYTES; j++)
+	crc_buf [j] = (uint8_t) rand32 ();
+}
+
+static uint32_t run_crc32 (void)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    int      j, k;
+
+    for (j = 0; j < CRC_BYTES; j++) {
+	crc ^= crc_buf [j];
+	for (k = 0; k < 8; k++)
+	    crc = (crc >> 1) ^ (0xEDB88320 & (- (crc & 1)));
+    }
+    return ~ crc;
+}
+
+// ================================================================
+// matmult_int
+
+#define MM_N  20
+
+static int32_t mm_a [MM_N][MM_N], mm_b [MM_N][MM_N], mm_c [MM_N][MM_N];
+
+static void init_matmult_int (void)
+{
+    int i, j;
+
+    for (i = 0; i < MM_N; i++)
+	for (j = 0; j < MM_N; j++) {
+	    mm_a [i][j] = (int32_t) (rand32 () % 8095) - 4047;
+	    mm_b [i][j] = (int32_t) (rand32 () % 8095) - 4047;
+	}
+}
+
+static uint32_t run_matmult_int (void)
+{
+    int      i, j, k;
+    uint32_t sum = 0;
+
+    for (i = 0; i < MM_N; i++)
+	for (j = 0; j < MM_N; j++) {
+	    int32_t acc = 0;
+	    for (k = 0; k < MM_N; k++)
+		acc += mm_a [i][k] * mm_b [k][j];
+	    mm_c [i][j] = acc;
+	}
+    for (i = 0; i < MM_N; i++)
+	for (j = 0; j < MM_N; j++)
+	    sum = (sum * 31) + (uint32_t) mm_c [i][j];
+    return sum;
+}
+
+// ================================================================
+// fir
+
+#define FIR_TAPS     32
+#define FIR_SAMPLES  256
+
+static int16_t fir_coef [FIR_TAPS];
+static int16_t fir_in   [FIR_SAMPLES + FIR_TAPS];
+static int32_t fir_out  [FIR_SAMPLES];
+
+static void init_fir (void)
+{
+    int j;
+
+    for (j = 0; j < FIR_TAPS; j++)
+	fir_coef [j] = (int16_t) ((rand32 () & 0x3ff) - 0x200);
+    for (j = 0; j < FIR_SAMPLES + FIR_TAPS; j++)
+	fir_in [j] = (int16_t) ((rand32 () & 0xfff) - 0x800);
+}
+
+static uint32_t run_fir (void)
+{
+    int      j, k;
+    uint32_t sum = 0;
+
+    for (j = 0; j < FIR_SAMPLES; j++) {
+	int32_t acc = 0;
+	for (k = 0; k < FIR_TAPS; k++)
+	    acc += (int32_t) fir_coef [k] * fir_in [j + k];
+	fir_out [j] = acc >> 15;
+    }
+    for (j = 0; j < FIR_SAMPLES; j++)
+	sum = (sum * 31) + (uint32_t) fir_out [j];
+    return sum;
+}
+
+// ================================================================
+// qsort (iterative, median-of-three, insertion sort for short ranges)
+
+#define QS_N  256
+
+static uint32_t qs_orig [QS_N], qs_data [QS_N];
+
+static void init_qsort (void)
+{
+    int j;
+
+    for (j = 0; j < QS_N; j++)
+	qs_orig [j] = rand32 ();
+}
+
+static void swap32 (uint32_t *a, uint32_t *b)
+{
+    uint32_t t = *a;
+    *a = *b;
+    *b = t;
+}
+
+static uint32_t run_qsort (void)
+{
+    int      stack [64];
+    int      sp = 0, lo, hi, i, j;
+    uint32_t sum = 0;
+
+    for (j = 0; j < QS_N; j++)
+	qs_data [j] = qs_orig [j];
+
+    stack [sp++] = 0;
+    stack [sp++] = QS_N - 1;
+    while (sp > 0) {
+	hi = stack [--sp];
+	lo = stack [--sp];
+	if (hi - lo < 8) {
+	    for (i = lo + 1; i <= hi; i++) {
+		uint32_t x = qs_data [i];
+		for (j = i - 1; (j >= lo) && (qs_data [j] > x); j--)
+		    qs_data [j + 1] = qs_data [j];
+		qs_data [j + 1] = x;
+	    }
+	    continue;
+	}
+	// Median of three into qs_data [hi]
+	{
+	    int mid = lo + (hi - lo) / 2;
+	    if (qs_data [mid] < qs_data [lo]) swap32 (& qs_data [mid], & qs_data [lo]);
+	    if (qs_data [hi]  < qs_data [lo]) swap32 (& qs_data [hi],  & qs_data [lo]);
+	    if (qs_data [mid] < qs_data [hi]) swap32 (& qs_data [mid], & qs_data [hi]);
+	}
+	i = lo - 1;
+	for (j = lo; j < hi; j++)
+	    if (qs_data [j] <= qs_data [hi])
+		swap32 (& qs_data [++i], & qs_data [j]);
+	swap32 (& qs_data [i + 1], & qs_data [hi]);
+	// Push the larger part first, so the stack stays shallow
+	if ((i - lo) > (hi - (i + 2))) {
+	    stack [sp++] = lo;    stack [sp++] = i;
+	    stack [sp++] = i + 2; stack [sp++] = hi;
+	} else {
+	    stack [sp++] = i + 2; stack [sp++] = hi;
+	    stack [sp++] = lo;    stack [sp++] = i;
+	}
+    }
+
+    for (j = 0; j < QS_N; j++) {
+	if ((j > 0) && (qs_data [j - 1] > qs_data [j]))
+	    return 0;    // not sorted
+	sum = (sum * 31) + qs_data [j];
+    }
+    return sum;
+}
+
+// ================================================================
+// bitcount
+
+#define BC_N  1024
+
+static uint32_t bc_data [BC_N];
+
+static const uint8_t nibble_bits [16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+static void init_bitcount (void)
+{
+    int j;
+
+    for (j = 0; j < BC_N; j++)
+	bc_data [j] = rand32 () & rand32 ();
+}
+
+static uint32_t run_bitcount (void)
+{
+    uint32_t n_shift = 0, n_sparse = 0, n_table = 0;
+    int      j;
+
+    for (j = 0; j < BC_N; j++) {
+	uint32_t x = bc_data [j];
+	int      k;
+
+	for (k = 0; k < 32; k++)
+	    n_shift += (x >> k) & 1;
+
+	for (; x != 0; x &= x - 1)
+	    n_sparse++;
+
+	x = bc_data [j];
+	for (k = 0; k < 8; k++, x >>= 4)
+	    n_table += nibble_bits [x & 0xf];
+    }
+    if ((n_shift != n_sparse) || (n_shift != n_table))
+	return 0;
+    return n_shift;
+}
+
+// ================================================================
+
+typedef struct {
+    const char *name;
+    void      (*init) (void);
+    uint32_t  (*run)  (void);
+    uint32_t    expected;
+} kernel_t;
+
+static const kernel_t kernels [] = {
+    {"crc32",       init_crc32,       run_crc32,       0x4ac297aa},
+    {"matmult_int", init_matmult_int, run_matmult_int, 0x761f69a7},
+    {"fir",         init_fir,         run_fir,         0xd276d35d},
+    {"qsort",       init_qsort,       run_qsort,       0x961d2c78},
+    {"bitcount",    init_bitcount,    run_bitcount,    0x00001fe6}
+};
+
+#define N_KERNELS  (sizeof (kernels) / sizeof (kernels [0]))
+
+int main (int argc, char *argv[])
+{
+    unsigned  k;
+    int       rep, n_fail = 0;
+
+    rand_state = 0x12345678;
+    for (k = 0; k < N_KERNELS; k++)
+	kernels [k].init ();
+
+    for (k = 0; k < N_KERNELS; k++) {
+	uint32_t result;
+	uint64_t cycles, instret;
+
+	kernels [k].run ();    // warm-up
+
+	cycles  = read_cycle ();
+	instret = read_instret ();
+	for (rep = 0; rep < REPEAT; rep++)
+	    result = kernels [k].run ();
+	cycles  = read_cycle ()   - cycles;
+	instret = read_instret () - instret;
+
+	print_bench (kernels [k].name, cycles, instret);
+	if (result != kernels [k].expected) {
+	    printf ("Verify %s: not ok (0x%08x, expected 0x%08x)\n",
+		    kernels [k].name, (unsigned) result, (unsigned) kernels [k].expected);
+	    n_fail++;
+	}
+    }
+
+    if (n_fail == 0) {
+	printf ("Verify: ok\n");
+	TEST_PASS
+    } else {
+	TEST_FAIL
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+extern void *_sbrk (int nbytes);
+
+// ================================================================
+
+void arena_init (arena_t *a, void *mem, size_t bytes)
+{
+    uintptr_t base  = ((uintptr_t) mem + (ARENA_ALIGN - 1)) & ~ ((uintptr_t) (ARENA_ALIGN - 1));
+    uintptr_t limit = (uintptr_t) mem + bytes;
+
+    a->base  = (char *) base;
+    a->limit = (char *) ((limit > base) ? limit : base);
+    arena_reset (a);
+}
+
+int arena_init_sbrk (arena_t *a, size_t bytes)
+{
+    // Extra room to align the start
+    void *mem = _sbrk ((int) (bytes + ARENA_ALIGN));
+
+    if (mem == (void *) -1) {
+	arena_init (a, NULL, 0);
+	return -1;
+    }
+    arena_init (a, mem, bytes + ARENA_ALIGN);
+    return 0;
+}
+
+void arena_reset (arena_t *a)
+{
+    int j;
+
+    a->ptr = a->base;
+    for (j = 0; j < ARENA_N_CLASSES; j++)
+	a->free_lists [j] = NULL;
+}
+
+// ================================================================
+// Size classes
+
+// Returns the class of 'bytes', or -1 if too large for any class
+static int size_class (size_t bytes)
+{
+    size_t class_bytes = ARENA_MIN_CLASS_BYTES;
+    int    j;
+
+    for (j = 0; j < ARENA_N_CLASSES; j++, class_bytes <<= 1)
+	if (bytes <= class_bytes)
+	    return j;
+    return -1;
+}
+
+void *arena_alloc_class (arena_t *a, size_t bytes)
+{
+    int   j = size_class (bytes);
+    void *p;
+
+    if (j < 0)
+	return arena_alloc (a, bytes);
+
+    p = a->free_lists [j];
+    if (p != NULL) {
+	a->free_lists [j] = * (void **) p;
+	return p;
+    }
+    return arena_alloc (a, ((size_t) ARENA_MIN_CLASS_BYTES) << j);
+}
+
+// Blocks larger than the largest class are not recycled
+void arena_free_class (arena_t *a, void *p, size_t bytes)
+{
+    int j = size_class (bytes);
+
+    if ((p == NULL) || (j < 0))
+	return;
+    * (void **) p = a->free_lists [j];
+    a->free_lists [j] = p;
+}
+
+// ================================================================
@@ -0,0 +1,66 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ================================================================
+// Arena (bump) allocator, for benchmarks that allocate, so that their
+// cycle counts measure the workload rather than newlib's malloc.
+//
+// An arena is a block of memory, from _sbrk () (i.e. the heap region
+// __heap_start .. __heap_end in bare.lds) or supplied by the caller.
+// arena_alloc () bumps a pointer; nothing is freed individually, and
+// arena_reset () releases everything at once, e.g. between benchmark
+// iterations.
+//
+// Optionally, blocks of up to ARENA_MAX_CLASS_BYTES can be recycled
+// through per-size-class free lists (powers of two, from
+// ARENA_MIN_CLASS_BYTES): arena_alloc_class () / arena_free_class ().
+// The caller passes the size to both; there is no block header.
+//
+// All results are aligned to ARENA_ALIGN bytes.  Allocation failure
+// returns NULL.
+
+#define ARENA_ALIGN            16
+#define ARENA_MIN_CLASS_BYTES  16
+#define ARENA_MAX_CLASS_BYTES  4096
+#define ARENA_N_CLASSES        9       // 16, 32, ..., 4096
+
+typedef struct {
+    char *base;
+    char *ptr;
+    char *limit;
+    void *free_lists [ARENA_N_CLASSES];
+} arena_t;
+
+// Returns 0 on success, -1 if _sbrk () cannot provide 'bytes'
+extern int    arena_init_sbrk (arena_t *a, size_t bytes);
+
+extern void   arena_init      (arena_t *a, void *mem, size_t bytes);
+extern void   arena_reset     (arena_t *a);
+
+extern void  *arena_alloc_class (arena_t *a, size_t bytes);
+extern void   arena_free_class  (arena_t *a, void *p, size_t bytes);
+
+// ----------------
+// Fast path, inline
+
+static inline void *arena_alloc (arena_t *a, size_t bytes)
+{
+    char *p = a->ptr;
+
+    bytes = (bytes + (ARENA_ALIGN - 1)) & ~ ((size_t) (ARENA_ALIGN - 1));
+    if (bytes > (size_t) (a->limit - p))
+	return NULL;
+    a->ptr = p + bytes;
+    return p;
+}
+
+static inline size_t arena_used (const arena_t *a)
+{
+    return (size_t) (a->ptr - a->base);
+}
+
+// ================================================================
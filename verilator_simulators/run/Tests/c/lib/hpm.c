@@ -0,0 +1,205 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// Hardware performance-monitor events (see hpm.h)
+// ================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "riscv_counters.h"
+#include "hpm.h"
+
+// ================================================================
+// Rocket event selectors: (1 << (8 + event)) | event set
+
+#define ROCKET_EVENT(set, bit)  ((1UL << (8 + (bit))) | (set))
+
+const hpm_event_t hpm_events [] = {
+    // Set 0: instruction classes (retired)
+    {"exception",              ROCKET_EVENT (0, 0)},
+    {"load",                   ROCKET_EVENT (0, 1)},
+    {"store",                  ROCKET_EVENT (0, 2)},
+    {"amo",                    ROCKET_EVENT (0, 3)},
+    {"system",                 ROCKET_EVENT (0, 4)},
+    {"arith",                  ROCKET_EVENT (0, 5)},
+    {"branch",                 ROCKET_EVENT (0, 6)},
+    {"jal",                    ROCKET_EVENT (0, 7)},
+    {"jalr",                   ROCKET_EVENT (0, 8)},
+    {"mul",                    ROCKET_EVENT (0, 9)},
+    {"div",                    ROCKET_EVENT (0, 10)},
+    {"fp_load",                ROCKET_EVENT (0, 11)},
+    {"fp_store",               ROCKET_EVENT (0, 12)},
+    {"fp_add",                 ROCKET_EVENT (0, 13)},
+    {"fp_mul",                 ROCKET_EVENT (0, 14)},
+    {"fp_muladd",              ROCKET_EVENT (0, 15)},
+    {"fp_divsqrt",             ROCKET_EVENT (0, 16)},
+    {"fp_other",               ROCKET_EVENT (0, 17)},
+
+    // Set 1: microarchitectural events (per cycle, for the stalls)
+    {"load_use_interlock",     ROCKET_EVENT (1, 0)},
+    {"long_latency_interlock", ROCKET_EVENT (1, 1)},
+    {"csr_interlock",          ROCKET_EVENT (1, 2)},
+    {"icache_blocked",         ROCKET_EVENT (1, 3)},
+    {"dcache_blocked",         ROCKET_EVENT (1, 4)},
+    {"branch_mispredict",      ROCKET_EVENT (1, 5)},
+    {"target_mispredict",      ROCKET_EVENT (1, 6)},
+    {"flush",                  ROCKET_EVENT (1, 7)},
+    {"replay",                 ROCKET_EVENT (1, 8)},
+    {"muldiv_interlock",       ROCKET_EVENT (1, 9)},
+    {"fp_interlock",           ROCKET_EVENT (1, 10)},
+
+    // Set 2: memory system
+    {"icache_miss",            ROCKET_EVENT (2, 0)},
+    {"dcache_miss",            ROCKET_EVENT (2, 1)},
+    {"dcache_release",         ROCKET_EVENT (2, 2)},
+    {"itlb_miss",              ROCKET_EVENT (2, 3)},
+    {"dtlb_miss",              ROCKET_EVENT (2, 4)},
+    {"l2tlb_miss",             ROCKET_EVENT (2, 5)},
+};
+
+const int hpm_n_events = sizeof (hpm_events) / sizeof (hpm_events [0]);
+
+const hpm_event_t *hpm_find_event (const char *name)
+{
+    int j;
+
+    for (j = 0; j < hpm_n_events; j++)
+	if (strcmp (hpm_events [j].name, name) == 0)
+	    return & hpm_events [j];
+    return NULL;
+}
+
+// ================================================================
+// Selector access.  mhpmevent<n> is CSR 0x320 + n.  The write and
+// read-back run with mtvec pointing at a handler that skips to the end
+// (interrupts masked), so a core without the CSR does not end the program.
+
+#define HPM_SET(n)                                                      \
+    case n:                                                             \
+        asm volatile ("la    t0, 1f\n"                                  \
+                      "csrrw t0, mtvec, t0\n"                           \
+                      "li    %1, 1\n"                                   \
+                      "csrw  %3, %2\n"                                  \
+                      "csrr  %0, %3\n"                                  \
+                      "j     2f\n"                                      \
+                      ".align 2\n"                                      \
+                      "1: li %1, 0\n"                                   \
+                      "la    t1, 2f\n"                                  \
+                      "csrw  mepc, t1\n"                                \
+                      "mret\n"                                          \
+                      "2: csrw mtvec, t0\n"                             \
+                      : "=&r" (readback), "=&r" (ok)                    \
+                      : "r" (selector), "i" (0x320 + n)                 \
+                      : "t0", "t1", "memory");                          \
+        break;
+
+int hpm_set_event (int counter, unsigned long selector)
+{
+    unsigned long mie, ok = 0, readback = 0;
+
+    asm volatile ("csrrci %0, mstatus, 0x8" : "=r" (mie));
+    switch (counter) {
+	HPM_CASES (HPM_SET)
+    default: break;
+    }
+    asm volatile ("csrs mstatus, %0" : : "r" (mie & 0x8));
+
+    return ok && (readback == selector);
+}
+
+int hpm_num_counters (void)
+{
+    int n;
+
+    for (n = 0; n < HPM_MAX_EVENTS; n++) {
+	int counter = HPM_FIRST_COUNTER + n;
+
+	if ((! hpm_counter_implemented (counter)) ||
+	    (! hpm_set_event (counter, hpm_events [0].selector)))
+	    break;
+	hpm_set_event (counter, 0);
+    }
+    return n;
+}
+
+// ================================================================
+// Discovery: for each event, whether hpmcounter3 accepts its selector,
+// and its count over a small workload with loads, stores, branches,
+// jumps and multiplies/divides
+
+volatile unsigned long hpm_probe_data [512];
+
+static void __attribute__ ((noinline)) hpm_probe_workload (void)
+{
+    unsigned long x = 1, j;
+
+    for (j = 0; j < 512; j++) {
+	x = x * 3 + hpm_probe_data [(j * 67) % 512];
+	if (x & 4)
+	    x = x / 3;
+	hpm_probe_data [j] = x;
+    }
+}
+
+void hpm_discover (void)
+{
+    int n = hpm_num_counters ();
+    int j;
+
+    printf ("HPM-COUNTERS %d\n", n);
+    if (n == 0)
+	return;
+
+    for (j = 0; j < hpm_n_events; j++) {
+	int         accepted = hpm_set_event (HPM_FIRST_COUNTER, hpm_events [j].selector);
+	bench_reg_t c0, c1;
+
+	c0 = read_hpmcounter (HPM_FIRST_COUNTER);
+	hpm_probe_workload ();
+	c1 = read_hpmcounter (HPM_FIRST_COUNTER);
+	printf ("HPM-EVENT %s selector=0x%lx accepted=%d probe=%lu\n",
+		hpm_events [j].name, hpm_events [j].selector, accepted,
+		accepted ? (unsigned long) (c1 - c0) : 0UL);
+    }
+    hpm_set_event (HPM_FIRST_COUNTER, 0);
+}
+
+// ================================================================
+// Regions
+
+int hpm_region_init (hpm_region_t *r, const char *name,
+		     const char * const *event_names, int n_names)
+{
+    int max = hpm_num_counters ();
+    int j;
+
+    r->name    = name;
+    r->n       = 0;
+    r->cycles  = 0;
+    r->instret = 0;
+    for (j = 0; (j < n_names) && (r->n < max); j++) {
+	const hpm_event_t *e = hpm_find_event (event_names [j]);
+
+	if ((e != NULL) && hpm_set_event (HPM_FIRST_COUNTER + r->n, e->selector)) {
+	    r->events [r->n] = e;
+	    r->counts [r->n] = 0;
+	    r->n++;
+	}
+    }
+    return r->n;
+}
+
+void hpm_region_report (const hpm_region_t *r)
+{
+    int j;
+
+    printf ("HPM %s cycles=%llu instret=%llu", r->name,
+	    (unsigned long long) r->cycles, (unsigned long long) r->instret);
+    for (j = 0; j < r->n; j++)
+	printf (" %s=%llu", r->events [j]->name, (unsigned long long) r->counts [j]);
+    printf ("\n");
+}
+
+// ================================================================
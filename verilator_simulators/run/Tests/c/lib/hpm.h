@@ -0,0 +1,96 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+#pragma once
+
+#include "riscv_counters.h"
+
+// ================================================================
+// Hardware performance-monitor (HPM) events.
+//
+// mhpmevent3..31 select what hpmcounter3..31 count.  Which counters exist,
+// and what the selector values mean, depends on the core:
+//  - Rocket (chisel P2/P3): a selector is (event mask << 8) | event set,
+//    counting when any event in the mask occurs; the sets are instruction
+//    classes (0), microarchitectural events (1) and memory-system events
+//    (2).  The number of counters is a build parameter (possibly 0).
+//  - Cores without HPM events (e.g. the Bluespec P1) hardwire the
+//    counters and selectors to zero, or trap on them.
+// hpm_events [] lists the Rocket events.  hpm_num_counters () and
+// hpm_set_event () find out at run time what this core accepts (they never
+// trap), and hpm_discover () prints what it finds.
+//
+// To profile a code region:
+//     static const char *names [] = {"load", "dcache_miss"};
+//     hpm_region_t r;
+//     hpm_region_init (& r, "my_region", names, 2);
+//     hpm_region_start (& r);  ...code...  hpm_region_stop (& r);
+//     hpm_region_report (& r);
+// Start/stop pairs accumulate.  A region counts at most hpm_num_counters ()
+// events at once; run it again with other events for more.
+//
+// Output lines (Hpm_report.py in the run directory turns them into cache
+// miss, branch misprediction and stall breakdowns):
+//     HPM-COUNTERS <n>
+//     HPM-EVENT <name> selector=0x<sel> accepted=<0|1> probe=<count>
+//     HPM <region> cycles=<n> instret=<n> <event>=<n> ...
+
+#define HPM_FIRST_COUNTER  3
+#define HPM_LAST_COUNTER   31
+#define HPM_MAX_EVENTS     (HPM_LAST_COUNTER - HPM_FIRST_COUNTER + 1)
+
+typedef struct {
+    const char    *name;
+    unsigned long  selector;
+} hpm_event_t;
+
+extern const hpm_event_t  hpm_events [];
+extern const int          hpm_n_events;
+
+extern const hpm_event_t *hpm_find_event (const char *name);
+
+// Number of counters, from hpmcounter3 up, whose selector is writable
+extern int  hpm_num_counters (void);
+
+// Selects 'selector' on hpmcounter<counter>; returns 1 if the selector
+// reads back as written, 0 otherwise
+extern int  hpm_set_event (int counter, unsigned long selector);
+
+extern void hpm_discover (void);
+
+typedef struct {
+    const char        *name;
+    int                n;
+    const hpm_event_t *events [HPM_MAX_EVENTS];
+    bench_reg_t        start_cycle, start_instret, start [HPM_MAX_EVENTS];
+    uint64_t           cycles, instret, counts [HPM_MAX_EVENTS];
+} hpm_region_t;
+
+// Programs hpmcounter3.. with the named events (unknown names, and names
+// beyond the number of counters, are dropped); returns the number kept
+extern int  hpm_region_init   (hpm_region_t *r, const char *name,
+			       const char * const *event_names, int n_names);
+extern void hpm_region_report (const hpm_region_t *r);
+
+static inline void hpm_region_start (hpm_region_t *r)
+{
+    int j;
+
+    for (j = 0; j < r->n; j++)
+	r->start [j] = read_hpmcounter (HPM_FIRST_COUNTER + j);
+    r->start_instret = bench_rdinstret ();
+    r->start_cycle   = bench_rdcycle ();
+}
+
+static inline void hpm_region_stop (hpm_region_t *r)
+{
+    bench_reg_t cycle   = bench_rdcycle ();
+    bench_reg_t instret = bench_rdinstret ();
+    int         j;
+
+    r->cycles  += cycle   - r->start_cycle;
+    r->instret += instret - r->start_instret;
+    for (j = 0; j < r->n; j++)
+	r->counts [j] += read_hpmcounter (HPM_FIRST_COUNTER + j) - r->start [j];
+}
+
+// ================================================================
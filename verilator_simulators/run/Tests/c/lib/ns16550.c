@@ -69,34 +69,196 @@ static int ns16550_init(void)
 #endif
 
 
+// ----------------------------------------------------------------
+// Buffered I/O
+//
+// Transmit: once THRE has been seen, the TX FIFO is empty and can take
+// NS16550_FIFO_DEPTH bytes without looking at LSR again (tx_room counts
+// down what is left).  Bytes that find the FIFO full wait in a ring
+// buffer, and go out in one burst the next time THRE is seen: on a later
+// ns16550_txchar () or ns16550_txpoll (), or from ns16550_isr () when
+// interrupts are enabled.  ns16550_flush () drains the ring buffer.
+//
+// Receive: in polling mode, straight from the RX FIFO.  With interrupts
+// enabled, ns16550_isr () moves received bytes to a ring buffer.
+//
+// Interrupts are off until ns16550_set_interrupts (1).  The caller must
+// route the UART interrupt through the PLIC and call ns16550_isr () from
+// its trap handler.  With interrupts off (in the UART, or masked in
+// mstatus), everything falls back to polling.
+
+#define MSTATUS_MIE  0x8
+
+static volatile uint8_t  tx_buf [NS16550_TX_BUF_SIZE];
+static volatile uint32_t tx_head, tx_tail;    // free-running counters
+static uint32_t          tx_room;
+
+static volatile uint8_t  rx_buf [NS16550_RX_BUF_SIZE];
+static volatile uint32_t rx_head, rx_tail;
+
+static volatile int      intr_enabled;
+
+
+// Mask machine interrupts; returns the previous mstatus.MIE
+static unsigned long irq_save(void)
+{
+  unsigned long x;
+
+  asm volatile ("csrrc %0, mstatus, %1" : "=r" (x) : "r" (MSTATUS_MIE) : "memory");
+  return x & MSTATUS_MIE;
+}
+
+
+static void irq_restore(unsigned long x)
+{
+  asm volatile ("csrs mstatus, %0" : : "r" (x) : "memory");
+}
+
+
+// Moves as much of the TX ring buffer as fits into the TX FIFO
+static void tx_fill(void)
+{
+  if (tx_head == tx_tail)
+    return;
+
+  if (tx_room == 0) {
+    if ((pio->lsr & LSR_THRE) == 0)
+      return;
+    tx_room = NS16550_FIFO_DEPTH;
+  }
+
+  while ((tx_room > 0) && (tx_head != tx_tail)) {
+    pio->thr = tx_buf [tx_tail % NS16550_TX_BUF_SIZE];
+    tx_tail++;
+    tx_room--;
+  }
+}
+
+
+static void rx_fill(void)
+{
+  while (pio->lsr & LSR_DR) {
+    uint8_t c = pio->rbr;
+
+    if (rx_head - rx_tail < NS16550_RX_BUF_SIZE) {
+      rx_buf [rx_head % NS16550_RX_BUF_SIZE] = c;
+      rx_head++;
+    }
+  }
+}
+
+
+void ns16550_isr(void)
+{
+  (void) pio->iir;    // clears a pending THRE interrupt
+
+  rx_fill();
+
+  tx_room = 0;
+  tx_fill();
+  if (tx_head == tx_tail)
+    pio->ier = IER_ERBI;
+}
+
+
+void ns16550_set_interrupts(int on)
+{
+  unsigned long mie = irq_save();
+
+  intr_enabled = on;
+  if (on)
+    pio->ier = (tx_head != tx_tail) ? (IER_ERBI | IER_ETBEI) : IER_ERBI;
+  else
+    pio->ier = 0;
+
+  irq_restore(mie);
+}
+
+
+int ns16550_txpoll(void)
+{
+  unsigned long mie = irq_save();
+  int pending;
+
+  tx_fill();
+  pending = tx_head - tx_tail;
+
+  irq_restore(mie);
+  return pending;
+}
+
+
 int ns16550_rxready(void)
 {
-  return ((pio->lsr & LSR_DR) != 0);
+  return (rx_head != rx_tail) || ((pio->lsr & LSR_DR) != 0);
 }
 
 
 int ns16550_rxchar(void)
 {
-  while ((pio->lsr & LSR_DR) == 0)
-    ;  // nothing
+  unsigned long mie;
+  int c;
+
+  for (;;) {
+    mie = irq_save();
+    if (rx_head == rx_tail)
+      rx_fill();
+    if (rx_head != rx_tail)
+      break;
+    irq_restore(mie);
+  }
 
-  return pio->rbr;
+  c = rx_buf [rx_tail % NS16550_RX_BUF_SIZE];
+  rx_tail++;
+  irq_restore(mie);
+
+  return c;
 }
 
 
 int ns16550_txchar(int c)
 {
-  while ((pio->lsr & LSR_THRE) == 0)
-    ;  // nothing
+  unsigned long mie = irq_save();
 
-  pio->thr = c;
+  // Straight into the FIFO if nothing is waiting and there is room
+  tx_fill();
+  if ((tx_head == tx_tail) && (tx_room == 0) && (pio->lsr & LSR_THRE))
+    tx_room = NS16550_FIFO_DEPTH;
+  if ((tx_head == tx_tail) && (tx_room > 0)) {
+    pio->thr = c;
+    tx_room--;
+    irq_restore(mie);
+    return c;
+  }
 
+  // Otherwise into the ring buffer, after making room for it
+  while (tx_head - tx_tail == NS16550_TX_BUF_SIZE) {
+    irq_restore(mie);
+    mie = irq_save();
+    tx_fill();
+  }
+  tx_buf [tx_head % NS16550_TX_BUF_SIZE] = c;
+  tx_head++;
+  if (intr_enabled)
+    pio->ier = IER_ERBI | IER_ETBEI;
+
+  irq_restore(mie);
   return c;
 }
 
 
+#ifdef CONSOLE_UART
+__attribute__ ((destructor))
+#endif
 void ns16550_flush(void)
 {
+  while (ns16550_txpoll() != 0)
+    ;  // nothing
+
   while ((pio->lsr & LSR_TEMT) == 0)
     ;  // nothing
+
+  // Look at THRE again before the next write, in case the caller
+  // writes THR itself
+  tx_room = 0;
 }
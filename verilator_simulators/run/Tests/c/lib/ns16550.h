@@ -6,6 +6,16 @@
 #define NS16550_BASE (0x62300000ULL)
 #define NS16550_CLOCK_RATE  (68000000ULL)
 
+#define NS16550_FIFO_DEPTH  16
+
+// Software ring buffers (powers of two)
+#ifndef NS16550_TX_BUF_SIZE
+#define NS16550_TX_BUF_SIZE  256
+#endif
+#ifndef NS16550_RX_BUF_SIZE
+#define NS16550_RX_BUF_SIZE  64
+#endif
+
 enum __attribute__ ((__packed__)) ier_t
 {
   IER_ERBI = (1<<0),
@@ -97,5 +107,10 @@ int ns16550_rxchar(void);
 int ns16550_txchar(int c);
 void ns16550_flush(void);
 
+// Buffered I/O (see ns16550.c)
+int ns16550_txpoll(void);
+void ns16550_set_interrupts(int on);
+void ns16550_isr(void);
+
 
 #endif
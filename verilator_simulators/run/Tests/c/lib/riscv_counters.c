@@ -3,6 +3,8 @@
 #include <stdio.h>
 #include <stdint.h>
 
+#include "riscv_counters.h"
+
 // ================================================================
 // The following are interfaces to inline RISC-V assembly instructions
 //     RDCYCLE, RDTIME, RDINSTRET
@@ -87,6 +89,22 @@ uint64_t  read_instret (void)
 
 #endif
 
+// ================================================================
+// Benchmark report (IPC is printed with integer arithmetic, so that
+// programs without floating point do not pull it in)
+
+void print_bench (const char *name, uint64_t cycles, uint64_t instret)
+{
+    uint64_t ipc_milli = (cycles == 0) ? 0 : ((instret * 1000) / cycles);
+
+    printf ("BENCH %s cycles=%llu instret=%llu ipc=%llu.%03llu\n",
+            name,
+            (unsigned long long) cycles,
+            (unsigned long long) instret,
+            (unsigned long long) (ipc_milli / 1000),
+            (unsigned long long) (ipc_milli % 1000));
+}
+
 // ================================================================
 // When reading/writing data needed by accelerators, we use 'fence' to
 // ensure that caches are empty, i.e., memory contains definitive data
@@ -125,3 +143,182 @@ void  io_write64 (uint64_t addr, uint64_t x)
 }
 
 // ================================================================
+// Benchmark harness (see riscv_counters.h)
+
+// CSR numbers are immediates, hence one case per counter (HPM_CASES)
+
+#define HPM_READ(n)                                                     \
+    case n: asm volatile ("csrr %0, %1" : "=r" (x) : "i" (0xC00 + n)); break;
+
+bench_reg_t read_hpmcounter (int n)
+{
+    bench_reg_t x = 0;
+
+    switch (n) {
+        HPM_CASES (HPM_READ)
+    default: break;
+    }
+    return x;
+}
+
+// Reads the counter with mtvec pointing at a handler that skips to the
+// end; interrupts are masked meanwhile, so only the read can trap
+
+#define HPM_PROBE(n)                                                    \
+    case n:                                                             \
+        asm volatile ("la    t0, 1f\n"                                  \
+                      "csrrw t0, mtvec, t0\n"                           \
+                      "li    %0, 1\n"                                   \
+                      "csrr  t1, %1\n"                                  \
+                      "j     2f\n"                                      \
+                      ".align 2\n"                                      \
+                      "1: li %0, 0\n"                                   \
+                      "la    t1, 2f\n"                                  \
+                      "csrw  mepc, t1\n"                                \
+                      "mret\n"                                          \
+                      "2: csrw mtvec, t0\n"                             \
+                      : "=&r" (ok) : "i" (0xC00 + n) : "t0", "t1", "memory"); \
+        break;
+
+int hpm_counter_implemented (int n)
+{
+    bench_reg_t mie;
+    bench_reg_t ok = 0;
+
+    asm volatile ("csrrci %0, mstatus, 0x8" : "=r" (mie));
+    switch (n) {
+        HPM_CASES (HPM_PROBE)
+    default: break;
+    }
+    asm volatile ("csrs mstatus, %0" : : "r" (mie & 0x8));
+    return (int) ok;
+}
+
+void bench_init (bench_t *b, const char *name, int warmup, int reps)
+{
+    b->name   = name;
+    b->warmup = warmup;
+    b->reps   = (reps > BENCH_MAX_REPS) ? BENCH_MAX_REPS : reps;
+    b->n      = 0;
+    b->n_hpm  = 0;
+}
+
+int bench_add_hpm (bench_t *b, int counter)
+{
+    if ((b->n_hpm >= BENCH_MAX_HPM) || (! hpm_counter_implemented (counter)))
+        return 0;
+    b->hpm [b->n_hpm++] = counter;
+    return 1;
+}
+
+// Minimum over a few runs; computed once
+void bench_overhead (bench_reg_t *cycles, bench_reg_t *instret)
+{
+    static int         done;
+    static bench_reg_t ovh_cycles, ovh_instret;
+
+    if (! done) {
+        bench_t b;
+        int     j;
+
+        bench_init (& b, "overhead", 0, 8);
+        for (j = 0; j < 8; j++) {
+            bench_start (& b);
+            bench_stop (& b);
+        }
+        ovh_cycles  = b.cycles [0];
+        ovh_instret = b.instret [0];
+        for (j = 1; j < b.n; j++) {
+            if (b.cycles [j] < ovh_cycles)   ovh_cycles  = b.cycles [j];
+            if (b.instret [j] < ovh_instret) ovh_instret = b.instret [j];
+        }
+        done = 1;
+    }
+    *cycles  = ovh_cycles;
+    *instret = ovh_instret;
+}
+
+// Minimum of each of b's event counters over a few empty runs.  Not cached:
+// what a counter counts, and so its overhead, depends on the event that
+// mhpmevent selects at the time.
+static void bench_hpm_overhead (const bench_t *b, bench_reg_t *ovh)
+{
+    bench_t o;
+    int     i, j;
+
+    bench_init (& o, "overhead", 0, 8);
+    for (j = 0; j < b->n_hpm; j++)
+        o.hpm [j] = b->hpm [j];
+    o.n_hpm = b->n_hpm;
+    for (i = 0; i < 8; i++) {
+        bench_start (& o);
+        bench_stop (& o);
+    }
+    for (j = 0; j < o.n_hpm; j++) {
+        ovh [j] = o.hpm_counts [j][0];
+        for (i = 1; i < o.n; i++)
+            if (o.hpm_counts [j][i] < ovh [j]) ovh [j] = o.hpm_counts [j][i];
+    }
+}
+
+// Sorts a copy of x [0..n-1]; returns the median, and min and max
+static bench_reg_t bench_stats (const bench_reg_t *x, int n, bench_reg_t *min, bench_reg_t *max)
+{
+    bench_reg_t sorted [BENCH_MAX_REPS];
+    int         i, j;
+
+    for (i = 0; i < n; i++) {
+        bench_reg_t v = x [i];
+        for (j = i - 1; (j >= 0) && (sorted [j] > v); j--)
+            sorted [j + 1] = sorted [j];
+        sorted [j + 1] = v;
+    }
+    *min = sorted [0];
+    *max = sorted [n - 1];
+    return sorted [n / 2];
+}
+
+static bench_reg_t bench_sub (bench_reg_t x, bench_reg_t y)
+{
+    return (x > y) ? (x - y) : 0;
+}
+
+void bench_report (bench_t *b)
+{
+    bench_reg_t ovh_cycles, ovh_instret, ovh_hpm [BENCH_MAX_HPM];
+    bench_reg_t cycles, instret, min, max, lo, hi;
+    uint64_t    ipc_milli;
+    int         j;
+
+    if (b->n == 0) {
+        printf ("BENCH %s no samples\n", b->name);
+        return;
+    }
+
+    bench_overhead (& ovh_cycles, & ovh_instret);
+    bench_hpm_overhead (b, ovh_hpm);
+    cycles  = bench_sub (bench_stats (b->cycles,  b->n, & min, & max), ovh_cycles);
+    instret = bench_sub (bench_stats (b->instret, b->n, & lo,  & hi),  ovh_instret);
+    ipc_milli = (cycles == 0) ? 0 : ((((uint64_t) instret) * 1000) / cycles);
+
+    printf ("BENCH %s cycles=%llu instret=%llu ipc=%llu.%03llu min=%llu max=%llu reps=%d overhead=%llu",
+            b->name,
+            (unsigned long long) cycles,
+            (unsigned long long) instret,
+            (unsigned long long) (ipc_milli / 1000),
+            (unsigned long long) (ipc_milli % 1000),
+            (unsigned long long) bench_sub (min, ovh_cycles),
+            (unsigned long long) bench_sub (max, ovh_cycles),
+            b->n,
+            (unsigned long long) ovh_cycles);
+    for (j = 0; j < b->n_hpm; j++)
+        printf (" hpm%d=%llu", b->hpm [j],
+                (unsigned long long) bench_sub (bench_stats (b->hpm_counts [j], b->n, & lo, & hi),
+                                                ovh_hpm [j]));
+    printf ("\n");
+
+    // Ready for another BENCH_RUN
+    b->n = 0;
+}
+
+// ================================================================
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 // ================================================================
 // The following are interfaces to inline RISC-V assembly instructions
 //     RDCYCLE, RDTIME, RDINSTRET
@@ -26,14 +28,151 @@ extern void      io_write32 (uint64_t addr, uint32_t x);
 extern uint64_t  io_read64  (uint64_t addr);
 extern void      io_write64 (uint64_t addr, uint64_t x);
 
+// ================================================================
+// Benchmark report.  Prints one line on the console, of the form
+//     BENCH <name> cycles=<n> instret=<n> ipc=<n.nnn>
+// which is what run/Run_benchmarks.py extracts from simulation logs.
+// 'cycles' and 'instret' are deltas of read_cycle () and read_instret ().
+
+extern void print_bench (const char *name, uint64_t cycles, uint64_t instret);
+
+// ================================================================
+// Benchmark harness.
+//
+//     bench_t b;
+//     bench_init (& b, "name", 2, 16);    // 2 warm-up runs, 16 timed
+//     bench_add_hpm (& b, 3);             // optional: also hpmcounter3
+//     BENCH_RUN (& b, code_to_time ());
+//
+// BENCH_RUN runs the code 'warmup' times untimed, then 'reps' times
+// between bench_start () and bench_stop (), and prints one line
+//     BENCH <name> cycles=<n> instret=<n> ipc=<n.nnn> min=<n> max=<n>
+//           reps=<n> overhead=<n> [hpm<k>=<n> ...]
+// where cycles, instret and hpm<k> are medians and min/max are cycles;
+// all have the cost of the counter reads themselves subtracted (calibrated
+// once for cycles and instret, see bench_overhead (), and at each report
+// for hpm<k>, whose events may have changed).  Run_benchmarks.py reads these lines
+// like those of print_bench ().
+//
+// Counters are read XLEN bits wide (one instruction, also on RV32), so a
+// single timed run must take fewer than 2^32 cycles on RV32.
+//
+// hpmcounter3..31 count whatever events mhpmevent3..31 select (see
+// hpm.h); bench_add_hpm () ignores counters that the core does not
+// implement (hpm_counter_implemented ()).
+
+#define BENCH_MAX_REPS  64
+#define BENCH_MAX_HPM   4
+
+typedef unsigned long bench_reg_t;    // XLEN bits
+
+typedef struct {
+    const char  *name;
+    int          warmup;
+    int          reps;
+    int          n;        // timed runs so far
+    int          n_hpm;
+    int          hpm [BENCH_MAX_HPM];
+    bench_reg_t  start_cycle, start_instret, start_hpm [BENCH_MAX_HPM];
+    bench_reg_t  cycles [BENCH_MAX_REPS];
+    bench_reg_t  instret [BENCH_MAX_REPS];
+    bench_reg_t  hpm_counts [BENCH_MAX_HPM][BENCH_MAX_REPS];
+} bench_t;
+
+extern void         bench_init    (bench_t *b, const char *name, int warmup, int reps);
+extern int          bench_add_hpm (bench_t *b, int counter);
+extern void         bench_report  (bench_t *b);
+
+// Cycles and instructions of an empty bench_start ()/bench_stop () pair
+extern void         bench_overhead (bench_reg_t *cycles, bench_reg_t *instret);
+
+// hpmcounter<n> (3..31); 0 for other n.  Reading a counter that is not
+// implemented traps: check with hpm_counter_implemented () first.
+extern bench_reg_t  read_hpmcounter (int n);
+extern int          hpm_counter_implemented (int n);
+
+// Expands M(n) for each HPM counter n, e.g. for the cases of a switch
+#define HPM_CASES(M)                                                    \
+    M(3)  M(4)  M(5)  M(6)  M(7)  M(8)  M(9)  M(10) M(11) M(12)         \
+    M(13) M(14) M(15) M(16) M(17) M(18) M(19) M(20) M(21) M(22)         \
+    M(23) M(24) M(25) M(26) M(27) M(28) M(29) M(30) M(31)
+
+static inline bench_reg_t bench_rdcycle (void)
+{
+    bench_reg_t x;
+
+    asm volatile ("rdcycle %0" : "=r" (x) : : "memory");
+    return x;
+}
+
+static inline bench_reg_t bench_rdinstret (void)
+{
+    bench_reg_t x;
+
+    asm volatile ("rdinstret %0" : "=r" (x) : : "memory");
+    return x;
+}
+
+// Event counters outside, cycle counter innermost
+static inline void bench_start (bench_t *b)
+{
+    int j;
+
+    for (j = 0; j < b->n_hpm; j++)
+        b->start_hpm [j] = read_hpmcounter (b->hpm [j]);
+    b->start_instret = bench_rdinstret ();
+    b->start_cycle   = bench_rdcycle ();
+}
+
+static inline void bench_stop (bench_t *b)
+{
+    bench_reg_t cycle   = bench_rdcycle ();
+    bench_reg_t instret = bench_rdinstret ();
+    int         j;
+
+    if (b->n < BENCH_MAX_REPS) {
+        b->cycles  [b->n] = cycle   - b->start_cycle;
+        b->instret [b->n] = instret - b->start_instret;
+        for (j = 0; j < b->n_hpm; j++)
+            b->hpm_counts [j][b->n] = read_hpmcounter (b->hpm [j]) - b->start_hpm [j];
+        b->n++;
+    }
+}
+
+#define BENCH_RUN(b, code...)                          \
+    do {                                               \
+        int bench_j_;                                  \
+        for (bench_j_ = 0; bench_j_ < (b)->warmup; bench_j_++) { \
+            code;                                      \
+        }                                              \
+        for (bench_j_ = 0; bench_j_ < (b)->reps; bench_j_++) {   \
+            bench_start (b);                           \
+            code;                                      \
+            bench_stop (b);                            \
+        }                                              \
+        bench_report (b);                              \
+    } while (0)
+
 // ================================================================
 // Pass/Fail macros. This is a temporary place-holder. To be moved to an
 // appropriate location under the env directory structure once we can converge
 // on a unified build environment for all tests
 
-#define TEST_PASS asm volatile ("li a0, 0x1"); \
+// Console output still buffered in the UART driver is sent first, since
+// the write to tohost ends a simulation.
+
+#ifdef CONSOLE_UART
+extern void ns16550_flush (void);
+#define TEST_FLUSH ns16550_flush ();
+#else
+#define TEST_FLUSH
+#endif
+
+#define TEST_PASS TEST_FLUSH \
+                  asm volatile ("li a0, 0x1"); \
                   asm volatile ("sw a0, tohost, t0");
-#define TEST_FAIL asm volatile ("li a0, 0x3"); \
+#define TEST_FAIL TEST_FLUSH \
+                  asm volatile ("li a0, 0x3"); \
                   asm volatile ("sw a0, tohost, t0");
 
 // ================================================================
@@ -0,0 +1,19 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// Keeps stdout unbuffered when the tests print through newlib's stdio.
+// With a working _sbrk (syscalls.c), newlib would give stdout a buffer
+// that is only flushed at exit, and a test ends by writing tohost.
+// Linked only into builds that use newlib's printf (not TINY_PRINTF=1,
+// where this would pull in stdio and malloc for nothing).
+// ================================================================
+
+#include <stdio.h>
+
+#ifdef CONSOLE_UART
+__attribute__ ((constructor))
+static void console_unbuffered (void)
+{
+    setvbuf (stdout, NULL, _IONBF, 0);
+}
+#endif
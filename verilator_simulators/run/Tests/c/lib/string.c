@@ -0,0 +1,180 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// memcpy, memset, memcmp and strlen, XLEN bits at a time.
+//
+// These replace newlib's byte-at-a-time versions (this object is linked
+// ahead of libc, see bare.lds).  Each aligns the destination with byte
+// accesses, then moves whole words in an unrolled loop, and finishes the
+// tail with byte accesses.  No misaligned word access is ever made (the
+// GFE cores trap on them): memcpy with a misaligned source loads aligned
+// words and merges neighbours with shifts; memcmp falls back to bytes
+// unless both sides share an alignment.
+//
+// Must be compiled with -fno-builtin -fno-tree-loop-distribute-patterns
+// (see the Makefile), or gcc may turn the loops below back into calls.
+// ================================================================
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned long word_t;    // XLEN bits
+
+#define W            sizeof (word_t)
+#define W_MASK       (W - 1)
+#define ONES         ((word_t) -1 / 0xFF)          // 0x0101...01
+#define HIGHS        (ONES << 7)                   // 0x8080...80
+
+// Below this many bytes, alignment does not pay
+#define SMALL_BYTES  (2 * W)
+
+#define MISALIGN(p)  ((uintptr_t) (p) & W_MASK)
+
+// Nonzero iff some byte of x is zero
+#define HAS_ZERO(x)  (((x) - ONES) & ~ (x) & HIGHS)
+
+// ================================================================
+
+void *memcpy (void *dst, const void *src, size_t n)
+{
+    unsigned char       *d = (unsigned char *) dst;
+    const unsigned char *s = (const unsigned char *) src;
+
+    if (n >= SMALL_BYTES) {
+	// Align the destination
+	while (MISALIGN (d) != 0) {
+	    *d++ = *s++;
+	    n--;
+	}
+
+	if (MISALIGN (s) == 0) {
+	    word_t       *dw = (word_t *) d;
+	    const word_t *sw = (const word_t *) s;
+
+	    for (; n >= 8 * W; n -= 8 * W, dw += 8, sw += 8) {
+		word_t x0 = sw [0], x1 = sw [1], x2 = sw [2], x3 = sw [3];
+		word_t x4 = sw [4], x5 = sw [5], x6 = sw [6], x7 = sw [7];
+		dw [0] = x0; dw [1] = x1; dw [2] = x2; dw [3] = x3;
+		dw [4] = x4; dw [5] = x5; dw [6] = x6; dw [7] = x7;
+	    }
+	    for (; n >= W; n -= W)
+		*dw++ = *sw++;
+	    d = (unsigned char *) dw;
+	    s = (const unsigned char *) sw;
+	}
+	else {
+	    // Little-endian: each destination word is the high part of one
+	    // aligned source word and the low part of the next.  The last
+	    // aligned load may extend past the source, but not out of its
+	    // last word.
+	    const unsigned  shift = 8 * MISALIGN (s);
+	    word_t         *dw    = (word_t *) d;
+	    const word_t   *sw    = (const word_t *) (s - MISALIGN (s));
+	    word_t          lo    = *sw++;
+
+	    for (; n >= W; n -= W) {
+		word_t hi = *sw++;
+		*dw++ = (lo >> shift) | (hi << (8 * W - shift));
+		lo = hi;
+		s += W;
+	    }
+	    d = (unsigned char *) dw;
+	}
+    }
+
+    while (n-- > 0)
+	*d++ = *s++;
+
+    return dst;
+}
+
+// ================================================================
+
+void *memset (void *dst, int c, size_t n)
+{
+    unsigned char *d = (unsigned char *) dst;
+
+    if (n >= SMALL_BYTES) {
+	const word_t x = ONES * (unsigned char) c;
+	word_t      *dw;
+
+	while (MISALIGN (d) != 0) {
+	    *d++ = (unsigned char) c;
+	    n--;
+	}
+
+	dw = (word_t *) d;
+	for (; n >= 8 * W; n -= 8 * W, dw += 8) {
+	    dw [0] = x; dw [1] = x; dw [2] = x; dw [3] = x;
+	    dw [4] = x; dw [5] = x; dw [6] = x; dw [7] = x;
+	}
+	for (; n >= W; n -= W)
+	    *dw++ = x;
+	d = (unsigned char *) dw;
+    }
+
+    while (n-- > 0)
+	*d++ = (unsigned char) c;
+
+    return dst;
+}
+
+// ================================================================
+
+int memcmp (const void *p1, const void *p2, size_t n)
+{
+    const unsigned char *a = (const unsigned char *) p1;
+    const unsigned char *b = (const unsigned char *) p2;
+
+    if ((n >= SMALL_BYTES) && (MISALIGN (a) == MISALIGN (b))) {
+	const word_t *aw, *bw;
+
+	while (MISALIGN (a) != 0) {
+	    if (*a != *b)
+		return *a - *b;
+	    a++; b++; n--;
+	}
+
+	// Stop at the first differing word; the bytes find the difference
+	aw = (const word_t *) a;
+	bw = (const word_t *) b;
+	for (; (n >= W) && (*aw == *bw); n -= W) {
+	    aw++;
+	    bw++;
+	}
+	a = (const unsigned char *) aw;
+	b = (const unsigned char *) bw;
+    }
+
+    for (; n > 0; n--, a++, b++)
+	if (*a != *b)
+	    return *a - *b;
+
+    return 0;
+}
+
+// ================================================================
+// Aligned word loads never cross a page (or a PMP region) boundary, so
+// reading the whole word that holds the terminating NUL is safe.
+
+size_t strlen (const char *str)
+{
+    const char   *s = str;
+    const word_t *sw;
+
+    while (MISALIGN (s) != 0) {
+	if (*s == 0)
+	    return s - str;
+	s++;
+    }
+
+    sw = (const word_t *) s;
+    while (! HAS_ZERO (*sw))
+	sw++;
+
+    for (s = (const char *) sw; *s != 0; s++)
+	;
+    return s - str;
+}
+
+// ================================================================
@@ -1,4 +1,5 @@
 #include <errno.h>
+#include <stddef.h>
 #include <sys/stat.h>
 #include <sys/times.h>
 #include <sys/time.h>
@@ -66,15 +67,27 @@ unsigned int sleep(unsigned int seconds)
     return 0;
 }
 
-// JES drafts:
+// Heap region, from bare.lds
+extern char __heap_start [], __heap_end [];
+
+static char *heap_brk = __heap_start;
 
 void *
 _sbrk (int nbytes)
 {
-  errno = ENOMEM;
-  return  (void *) -1;
+  char *old_brk = heap_brk;
+
+  if ((nbytes > 0) ? (nbytes > __heap_end - heap_brk)
+                   : (- nbytes > heap_brk - __heap_start)) {
+    errno = ENOMEM;
+    return  (void *) -1;
+  }
+  heap_brk += nbytes;
+  return old_brk;
 }
 
+// JES drafts:
+
 /*
 int _write(
    int fd,
@@ -0,0 +1,570 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// A small printf for the bare-metal tests, linked in place of newlib's
+// stdio formatter when building with
+//     make TINY_PRINTF=1
+// printf, puts and putchar write straight to the console UART
+// (ns16550_txchar); snprintf, vsnprintf and sprintf write to a buffer.
+// No heap, no static state: the functions are reentrant.
+//
+// Conversions: %d %i %u %x %X %o %c %s %p %% and, lite, %f %e %g.
+// Flags '-' '0' '+' ' ' '#', field width and precision (also '*'), and
+// length modifiers hh h l ll z j t are accepted.
+//
+// Floating point is converted with double arithmetic, so only about the
+// first 15 significant digits are exact; %.17e prints 17 digits, but the
+// last ones may differ from newlib's.  Values beyond 2^63 in %f are
+// printed as with %e.
+// ================================================================
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "ns16550.h"
+
+#undef putchar
+
+// ================================================================
+// Output: to a buffer, or to the UART if buf is NULL
+
+typedef struct {
+    char   *buf;
+    size_t  size;     // of buf, including the terminating NUL
+    size_t  len;      // characters produced so far (even if not stored)
+} out_t;
+
+static void out_char (out_t *out, char c)
+{
+    if (out->buf == NULL)
+	ns16550_txchar (c);
+    else if (out->len + 1 < out->size)
+	out->buf [out->len] = c;
+    out->len++;
+}
+
+static void out_pad (out_t *out, char c, int n)
+{
+    for (; n > 0; n--)
+	out_char (out, c);
+}
+
+// ================================================================
+// One conversion's options
+
+#define F_LEFT   0x01
+#define F_ZERO   0x02
+#define F_PLUS   0x04
+#define F_SPACE  0x08
+#define F_ALT    0x10
+
+typedef struct {
+    int flags;
+    int width;       // -1 if none
+    int precision;   // -1 if none
+} spec_t;
+
+// Prints sign/prefix, then body (already converted digits), padded to the
+// field width; 'zeros' leading zeros go between the prefix and the body
+static void out_field (out_t *out, const spec_t *spec,
+		       const char *prefix, int zeros, const char *body, int body_len)
+{
+    int prefix_len = 0, pad;
+
+    while (prefix [prefix_len] != 0)
+	prefix_len++;
+
+    pad = spec->width - (prefix_len + zeros + body_len);
+    if (pad < 0)
+	pad = 0;
+
+    if ((spec->flags & F_LEFT) == 0) {
+	if (spec->flags & F_ZERO)
+	    zeros += pad;
+	else
+	    out_pad (out, ' ', pad);
+    }
+    while (*prefix != 0)
+	out_char (out, *prefix++);
+    out_pad (out, '0', zeros);
+    for (; body_len > 0; body_len--)
+	out_char (out, *body++);
+    if (spec->flags & F_LEFT)
+	out_pad (out, ' ', pad);
+}
+
+// ================================================================
+// Integers
+
+static void out_integer (out_t *out, spec_t *spec,
+			 unsigned long long x, int negative, unsigned base, int upper)
+{
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char        buf [24];    // 64 bits in octal is 22 digits
+    int         n = 0, zeros = 0;
+    const char *prefix = "";
+
+    while (x != 0) {
+	buf [sizeof (buf) - 1 - n] = digits [x % base];
+	x /= base;
+	n++;
+    }
+
+    if (spec->precision >= 0) {
+	spec->flags &= ~F_ZERO;
+	if (spec->precision > n)
+	    zeros = spec->precision - n;
+    }
+    else if (n == 0)
+	zeros = 1;
+
+    if (negative)
+	prefix = "-";
+    else if (spec->flags & F_PLUS)
+	prefix = "+";
+    else if (spec->flags & F_SPACE)
+	prefix = " ";
+    else if ((spec->flags & F_ALT) && (n > 0)) {
+	if (base == 16)
+	    prefix = upper ? "0X" : "0x";
+	else if ((base == 8) && (zeros == 0))
+	    prefix = "0";
+    }
+
+    out_field (out, spec, prefix, zeros, & buf [sizeof (buf) - n], n);
+}
+
+// ================================================================
+// Floating point (lite)
+
+#define FP_BUF  64    // holds any %e, and %f up to 19 + 1 + precision
+
+static const double pow10_pos [] = {1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256};
+
+// Returns e and sets *m such that x = m * 10^e, 1 <= m < 10 (x > 0)
+static int fp_normalize (double x, double *m)
+{
+    int e = 0, j;
+
+    if (x >= 10.0) {
+	for (j = 8; j >= 0; j--)
+	    if (x >= pow10_pos [j]) {
+		x /= pow10_pos [j];
+		e += 1 << j;
+	    }
+    }
+    else if (x < 1.0) {
+	for (j = 8; j >= 0; j--)
+	    if (x * pow10_pos [j] < 10.0) {
+		x *= pow10_pos [j];
+		e -= 1 << j;
+	    }
+    }
+    // Correct any rounding at the boundaries
+    if (x >= 10.0) { x /= 10.0; e++; }
+    if (x < 1.0)   { x *= 10.0; e--; }
+
+    *m = x;
+    return e;
+}
+
+// Digits of m (1 <= m < 10) as d.ddd, 'precision' decimals, rounded;
+// returns the exponent (bumped if rounding carried into a new digit)
+static int fp_digits_e (double x, int precision, char *buf, int *len)
+{
+    double m, r = 0.5;
+    int    e, j, n = 0;
+
+    e = fp_normalize (x, & m);
+    for (j = 0; j < precision; j++)
+	r /= 10.0;
+    m += r;
+    if (m >= 10.0) {
+	m /= 10.0;
+	e++;
+    }
+
+    for (j = 0; j <= precision; j++) {
+	int d = (int) m;
+
+	if (d > 9)
+	    d = 9;
+	buf [n++] = '0' + d;
+	if ((j == 0) && (precision > 0))
+	    buf [n++] = '.';
+	m = (m - d) * 10.0;
+    }
+    *len = n;
+    return e;
+}
+
+static int fp_format_e (double x, int precision, int upper, char *buf)
+{
+    int len, e;
+
+    if (x == 0.0) {
+	int j;
+
+	len = 0;
+	buf [len++] = '0';
+	if (precision > 0)
+	    buf [len++] = '.';
+	for (j = 0; j < precision; j++)
+	    buf [len++] = '0';
+	e = 0;
+    }
+    else
+	e = fp_digits_e (x, precision, buf, & len);
+
+    buf [len++] = upper ? 'E' : 'e';
+    buf [len++] = (e < 0) ? '-' : '+';
+    if (e < 0)
+	e = -e;
+    if (e >= 100)
+	buf [len++] = '0' + (e / 100);
+    buf [len++] = '0' + ((e / 10) % 10);
+    buf [len++] = '0' + (e % 10);
+    return len;
+}
+
+// Returns -1 if x is too large for %f here
+static int fp_format_f (double x, int precision, char *buf)
+{
+    unsigned long long ip;
+    double             r = 0.5, frac;
+    char               tmp [20];
+    int                j, n = 0, len = 0;
+
+    for (j = 0; j < precision; j++)
+	r /= 10.0;
+    x += r;
+    if (x >= 9.2e18)
+	return -1;
+
+    ip   = (unsigned long long) x;
+    frac = x - (double) ip;
+    do {
+	tmp [n++] = '0' + (ip % 10);
+	ip /= 10;
+    } while (ip != 0);
+    while (n > 0)
+	buf [len++] = tmp [--n];
+
+    if (precision > 0)
+	buf [len++] = '.';
+    for (j = 0; j < precision; j++) {
+	int d;
+
+	frac *= 10.0;
+	d = (int) frac;
+	if (d > 9)
+	    d = 9;
+	buf [len++] = '0' + d;
+	frac -= d;
+    }
+    return len;
+}
+
+static void out_double (out_t *out, spec_t *spec, double x, char conv)
+{
+    char        buf [FP_BUF];
+    int         len, upper = (conv == 'E') || (conv == 'G') || (conv == 'F');
+    int         negative = (x < 0.0) || ((x == 0.0) && (1.0 / x < 0.0));
+    const char *prefix;
+    int         precision = (spec->precision < 0) ? 6 : spec->precision;
+
+    prefix = negative ? "-" : ((spec->flags & F_PLUS) ? "+" : ((spec->flags & F_SPACE) ? " " : ""));
+    if (negative)
+	x = -x;
+
+    if (x != x) {
+	spec->flags &= ~F_ZERO;
+	out_field (out, spec, prefix, 0, upper ? "NAN" : "nan", 3);
+	return;
+    }
+    if (x > 1.7976931348623157e308) {
+	spec->flags &= ~F_ZERO;
+	out_field (out, spec, prefix, 0, upper ? "INF" : "inf", 3);
+	return;
+    }
+
+    // Keep within buf
+    if (precision > FP_BUF - 28)
+	precision = FP_BUF - 28;
+
+    switch (conv) {
+    case 'f': case 'F':
+	len = fp_format_f (x, precision, buf);
+	if (len < 0)
+	    len = fp_format_e (x, precision, upper, buf);
+	break;
+
+    case 'e': case 'E':
+	len = fp_format_e (x, precision, upper, buf);
+	break;
+
+    default: {    // 'g', 'G'
+	int    p = (precision == 0) ? 1 : precision;
+	int    e = 0;
+	char   tmp [FP_BUF];
+	int    tmp_len;
+
+	if (x != 0.0)
+	    e = fp_digits_e (x, p - 1, tmp, & tmp_len);
+	if ((e < -4) || (e >= p))
+	    len = fp_format_e (x, p - 1, upper, buf);
+	else
+	    len = fp_format_f (x, p - 1 - e, buf);
+
+	// Strip trailing zeros of the fraction (and a trailing point)
+	if ((spec->flags & F_ALT) == 0) {
+	    int j, point = -1, exp_at = len;
+
+	    for (j = 0; j < len; j++) {
+		if (buf [j] == '.')
+		    point = j;
+		if ((buf [j] == 'e') || (buf [j] == 'E'))
+		    exp_at = j;
+	    }
+	    if (point >= 0) {
+		int end = exp_at;
+
+		while ((end > point + 1) && (buf [end - 1] == '0'))
+		    end--;
+		if (end == point + 1)
+		    end = point;
+		for (j = exp_at; j < len; j++)
+		    buf [end + (j - exp_at)] = buf [j];
+		len = end + (len - exp_at);
+	    }
+	}
+	break;
+    }
+    }
+
+    out_field (out, spec, prefix, 0, buf, len);
+}
+
+// ================================================================
+// The formatter
+
+static int format (out_t *out, const char *fmt, va_list ap)
+{
+    while (*fmt != 0) {
+	spec_t spec;
+	int    length = 0;    // -2 hh, -1 h, 0 int, 1 long, 2 long long, 3 size_t/ptrdiff_t
+	char   conv;
+
+	if (*fmt != '%') {
+	    out_char (out, *fmt++);
+	    continue;
+	}
+	fmt++;
+
+	// Flags
+	spec.flags = 0;
+	for (;; fmt++) {
+	    if      (*fmt == '-') spec.flags |= F_LEFT;
+	    else if (*fmt == '0') spec.flags |= F_ZERO;
+	    else if (*fmt == '+') spec.flags |= F_PLUS;
+	    else if (*fmt == ' ') spec.flags |= F_SPACE;
+	    else if (*fmt == '#') spec.flags |= F_ALT;
+	    else break;
+	}
+
+	// Width and precision
+	spec.width = -1;
+	if (*fmt == '*') {
+	    spec.width = va_arg (ap, int);
+	    if (spec.width < 0) {
+		spec.flags |= F_LEFT;
+		spec.width = - spec.width;
+	    }
+	    fmt++;
+	}
+	else
+	    for (; (*fmt >= '0') && (*fmt <= '9'); fmt++)
+		spec.width = ((spec.width < 0) ? 0 : 10 * spec.width) + (*fmt - '0');
+
+	spec.precision = -1;
+	if (*fmt == '.') {
+	    fmt++;
+	    spec.precision = 0;
+	    if (*fmt == '*') {
+		spec.precision = va_arg (ap, int);
+		fmt++;
+	    }
+	    else
+		for (; (*fmt >= '0') && (*fmt <= '9'); fmt++)
+		    spec.precision = 10 * spec.precision + (*fmt - '0');
+	}
+	if (spec.flags & F_LEFT)
+	    spec.flags &= ~F_ZERO;
+
+	// Length
+	for (;; fmt++) {
+	    if      (*fmt == 'h') length--;
+	    else if (*fmt == 'l') length++;
+	    else if ((*fmt == 'z') || (*fmt == 't')) length = 3;
+	    else if (*fmt == 'j') length = 2;
+	    else break;
+	}
+
+	conv = *fmt;
+	if (conv == 0)
+	    break;
+	fmt++;
+
+	switch (conv) {
+	case 'd': case 'i': {
+	    long long x;
+
+	    if      (length >= 3) x = va_arg (ap, ptrdiff_t);
+	    else if (length == 2) x = va_arg (ap, long long);
+	    else if (length == 1) x = va_arg (ap, long);
+	    else                  x = va_arg (ap, int);
+	    if      (length == -1) x = (short) x;
+	    else if (length <= -2) x = (signed char) x;
+	    out_integer (out, & spec, (x < 0) ? - (unsigned long long) x : (unsigned long long) x,
+			 x < 0, 10, 0);
+	    break;
+	}
+
+	case 'u': case 'x': case 'X': case 'o': {
+	    unsigned long long x;
+
+	    if      (length >= 3) x = va_arg (ap, size_t);
+	    else if (length == 2) x = va_arg (ap, unsigned long long);
+	    else if (length == 1) x = va_arg (ap, unsigned long);
+	    else                  x = va_arg (ap, unsigned int);
+	    if      (length == -1) x = (unsigned short) x;
+	    else if (length <= -2) x = (unsigned char) x;
+	    spec.flags &= ~(F_PLUS | F_SPACE);
+	    out_integer (out, & spec, x, 0,
+			 (conv == 'u') ? 10 : ((conv == 'o') ? 8 : 16), conv == 'X');
+	    break;
+	}
+
+	case 'p':
+	    spec.flags = (spec.flags | F_ALT) & ~(F_PLUS | F_SPACE);
+	    out_integer (out, & spec, (uintptr_t) va_arg (ap, void *), 0, 16, 0);
+	    break;
+
+	case 'c': {
+	    char c = (char) va_arg (ap, int);
+
+	    spec.flags &= ~F_ZERO;
+	    out_field (out, & spec, "", 0, & c, 1);
+	    break;
+	}
+
+	case 's': {
+	    const char *s = va_arg (ap, const char *);
+	    int         n = 0;
+
+	    if (s == NULL)
+		s = "(null)";
+	    while ((s [n] != 0) && ((spec.precision < 0) || (n < spec.precision)))
+		n++;
+	    spec.flags &= ~F_ZERO;
+	    out_field (out, & spec, "", 0, s, n);
+	    break;
+	}
+
+	case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+	    out_double (out, & spec, va_arg (ap, double), conv);
+	    break;
+
+	case '%':
+	    out_char (out, '%');
+	    break;
+
+	default:    // Unknown: print it as it was
+	    out_char (out, '%');
+	    out_char (out, conv);
+	    break;
+	}
+    }
+
+    if (out->buf != NULL)
+	out->buf [(out->len < out->size) ? out->len : out->size - 1] = 0;
+    return (int) out->len;
+}
+
+// ================================================================
+// The API
+
+int vsnprintf (char *buf, size_t size, const char *fmt, va_list ap)
+{
+    char  dummy;
+    out_t out;
+
+    // size 0: count only (buf may be NULL)
+    out.buf  = (size == 0) ? & dummy : buf;
+    out.size = (size == 0) ? 1 : size;
+    out.len  = 0;
+    return format (& out, fmt, ap);
+}
+
+int snprintf (char *buf, size_t size, const char *fmt, ...)
+{
+    va_list ap;
+    int     n;
+
+    va_start (ap, fmt);
+    n = vsnprintf (buf, size, fmt, ap);
+    va_end (ap);
+    return n;
+}
+
+int sprintf (char *buf, const char *fmt, ...)
+{
+    va_list ap;
+    int     n;
+
+    va_start (ap, fmt);
+    n = vsnprintf (buf, (size_t) -1 / 2, fmt, ap);
+    va_end (ap);
+    return n;
+}
+
+int vprintf (const char *fmt, va_list ap)
+{
+    out_t out;
+
+    out.buf  = NULL;
+    out.size = 0;
+    out.len  = 0;
+    return format (& out, fmt, ap);
+}
+
+int printf (const char *fmt, ...)
+{
+    va_list ap;
+    int     n;
+
+    va_start (ap, fmt);
+    n = vprintf (fmt, ap);
+    va_end (ap);
+    return n;
+}
+
+// gcc turns printf ("...\n") into puts, and printf ("%c") into putchar
+
+int puts (const char *s)
+{
+    while (*s != 0)
+	ns16550_txchar (*s++);
+    ns16550_txchar ('\n');
+    return 1;
+}
+
+int putchar (int c)
+{
+    ns16550_txchar (c);
+    return (unsigned char) c;
+}
+
+// ================================================================
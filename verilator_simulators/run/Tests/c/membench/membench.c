@@ -0,0 +1,329 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// membench: memory-system benchmarks for the path through the caches,
+// the AXI fabric and the DDR controller.
+//
+//  - STREAM copy/scale/add/triad (after J. McCalpin's STREAM), on
+//    XLEN-bit integer elements (P1 has no FPU), for array sizes from
+//    1 KiB up to MAX_KB, reported as bytes per cycle.
+//  - Pointer chase through a random cyclic permutation of cache-line
+//    sized nodes (Sattolo's algorithm), for working sets from 1 KiB up to
+//    MAX_KB, reported as cycles per load (load-to-use latency).
+//  - Strided reads over a MAX_KB working set, for strides from one
+//    element to 4 KiB, reported as cycles per access.
+//
+// Each measurement is run once untimed and then NTIMES timed; the fastest
+// is reported in a table, and after each table in BENCH lines (see
+// riscv_counters.h) for Run_benchmarks.py.
+//
+// The buffers are not part of the program image: they live at the fixed
+// address BUF_BASE, well above the program, its bss and its stack
+// (startup.S puts the stack at 0xC00F0000), and occupy 3 * MAX_KB KiB.
+//
+// The default MAX_KB is several times the L1 cache sizes of the GFE
+// processors, yet keeps a Verilator run short.  On the VCU118, build with
+// a working set well beyond any cache, e.g.
+//     make XLEN=64 MEMBENCH_FLAGS=-DMAX_KB=65536
+// ================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "riscv_counters.h"
+
+#ifndef BUF_BASE
+#define BUF_BASE  0xC1000000UL
+#endif
+
+#ifndef MAX_KB
+#define MAX_KB    256
+#endif
+
+#ifndef NTIMES
+#define NTIMES    2
+#endif
+
+#define LINE_BYTES       64
+#define MAX_STRIDE       4096
+#define CHASE_MIN_LOADS  8192
+#define STRIDE_ACCESSES  16384
+
+// Rows per table (sizes and strides are powers of two)
+#define MAX_ROWS         32
+
+typedef unsigned long elem_t;    // XLEN bits
+
+#define ARRAY_A  ((elem_t *) (BUF_BASE))
+#define ARRAY_B  ((elem_t *) (BUF_BASE + 1 * MAX_KB * 1024UL))
+#define ARRAY_C  ((elem_t *) (BUF_BASE + 2 * MAX_KB * 1024UL))
+
+// Results of loads, so that they are not optimized away
+volatile elem_t sink;
+
+// ================================================================
+// Help functions
+
+typedef struct {
+    uint64_t cycles;
+    uint64_t instret;
+} sample_t;
+
+static sample_t sample_start (void)
+{
+    sample_t s;
+
+    s.instret = read_instret ();
+    s.cycles  = read_cycle ();
+    return s;
+}
+
+// Returns the faster of 'best' and the interval since 's0'
+static sample_t sample_best (sample_t s0, sample_t best)
+{
+    sample_t s;
+
+    s.cycles  = read_cycle ()   - s0.cycles;
+    s.instret = read_instret () - s0.instret;
+    return ((best.cycles == 0) || (s.cycles < best.cycles)) ? s : best;
+}
+
+// Prints n/d with 3 decimals, using integer arithmetic only
+static void print_ratio (uint64_t n, uint64_t d)
+{
+    uint64_t milli = (d == 0) ? 0 : ((n * 1000) / d);
+    char     buf [32];
+
+    snprintf (buf, sizeof (buf), "%llu.%03llu",
+	      (unsigned long long) (milli / 1000), (unsigned long long) (milli % 1000));
+    printf (" %10s", buf);
+}
+
+static uint32_t rand_state = 0x2545F491;
+
+static uint32_t rand32 (void)
+{
+    uint32_t x = rand_state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rand_state = x;
+    return x;
+}
+
+// ================================================================
+// STREAM
+
+#define N_STREAM_KERNELS  4
+
+static const char *stream_names [N_STREAM_KERNELS] = {"copy", "scale", "add", "triad"};
+
+// Elements read plus written, per element of the arrays
+static const int stream_words [N_STREAM_KERNELS] = {2, 2, 3, 3};
+
+static void stream_kernel (int k, unsigned long n)
+{
+    elem_t * const a = ARRAY_A;
+    elem_t * const b = ARRAY_B;
+    elem_t * const c = ARRAY_C;
+    const elem_t   scalar = 3;
+    unsigned long  j;
+
+    switch (k) {
+    case 0: for (j = 0; j < n; j++) c [j] = a [j];                   break;
+    case 1: for (j = 0; j < n; j++) b [j] = scalar * c [j];          break;
+    case 2: for (j = 0; j < n; j++) c [j] = a [j] + b [j];           break;
+    case 3: for (j = 0; j < n; j++) a [j] = b [j] + scalar * c [j];  break;
+    }
+}
+
+static void run_stream (void)
+{
+    unsigned long kb, n, j;
+    int           k, rep, row, n_rows = 0;
+    sample_t      best [MAX_ROWS][N_STREAM_KERNELS];
+    char          name [32];
+
+    printf ("\nSTREAM: bytes per cycle (%d-bit elements)\n", (int) (8 * sizeof (elem_t)));
+    printf ("%10s", "array KiB");
+    for (k = 0; k < N_STREAM_KERNELS; k++)
+	printf (" %10s", stream_names [k]);
+    printf ("\n");
+
+    for (kb = 1; kb <= MAX_KB; kb *= 2) {
+	n = (kb * 1024) / sizeof (elem_t);
+	for (j = 0; j < n; j++) {
+	    ARRAY_A [j] = 1;
+	    ARRAY_B [j] = 2;
+	    ARRAY_C [j] = 0;
+	}
+
+	for (k = 0; k < N_STREAM_KERNELS; k++) {
+	    best [n_rows][k].cycles = 0;
+	    stream_kernel (k, n);    // warm-up
+	    for (rep = 0; rep < NTIMES; rep++) {
+		sample_t s0 = sample_start ();
+		stream_kernel (k, n);
+		best [n_rows][k] = sample_best (s0, best [n_rows][k]);
+	    }
+	}
+
+	printf ("%10lu", kb);
+	for (k = 0; k < N_STREAM_KERNELS; k++)
+	    print_ratio (stream_words [k] * n * sizeof (elem_t), best [n_rows][k].cycles);
+	printf ("\n");
+	n_rows++;
+    }
+
+    for (row = 0, kb = 1; row < n_rows; row++, kb *= 2)
+	for (k = 0; k < N_STREAM_KERNELS; k++) {
+	    snprintf (name, sizeof (name), "stream_%s_%luK", stream_names [k], kb);
+	    print_bench (name, best [row][k].cycles, best [row][k].instret);
+	}
+}
+
+// ================================================================
+// Pointer chase: each load's address depends on the previous load
+
+typedef struct node_s {
+    struct node_s *next;
+    char           pad [LINE_BYTES - sizeof (struct node_s *)];
+} node_t;
+
+// Links n nodes into a single random cycle; returns its start
+static node_t *chase_init (unsigned long n)
+{
+    node_t   * const nodes = (node_t *)   ARRAY_A;
+    uint32_t * const perm  = (uint32_t *) ARRAY_B;
+    unsigned long    j, k;
+    uint32_t         t;
+
+    // Sattolo's algorithm: a uniformly random permutation with one cycle
+    for (j = 0; j < n; j++)
+	perm [j] = j;
+    for (j = n - 1; j > 0; j--) {
+	k = rand32 () % j;
+	t = perm [j]; perm [j] = perm [k]; perm [k] = t;
+    }
+    for (j = 0; j < n; j++)
+	nodes [j].next = & nodes [perm [j]];
+    return & nodes [0];
+}
+
+static node_t *chase (node_t *p, unsigned long loads)
+{
+    unsigned long j;
+
+    for (j = 0; j < loads; j += 4) {
+	p = p->next;
+	p = p->next;
+	p = p->next;
+	p = p->next;
+    }
+    return p;
+}
+
+static void run_chase (void)
+{
+    unsigned long kb, n, loads;
+    int           rep, row, n_rows = 0;
+    node_t       *p;
+    sample_t      best [MAX_ROWS];
+    char          name [32];
+
+    printf ("\nPointer chase: cycles per load (%d-byte nodes, random order)\n", LINE_BYTES);
+    printf ("%10s %10s\n", "set KiB", "cycles");
+
+    for (kb = 1; kb <= MAX_KB; kb *= 2) {
+	n     = (kb * 1024) / sizeof (node_t);
+	loads = (n < CHASE_MIN_LOADS) ? CHASE_MIN_LOADS : n;
+	p     = chase_init (n);
+
+	best [n_rows].cycles = 0;
+	p = chase (p, n);    // warm-up
+	for (rep = 0; rep < NTIMES; rep++) {
+	    sample_t s0 = sample_start ();
+	    p = chase (p, loads);
+	    best [n_rows] = sample_best (s0, best [n_rows]);
+	}
+	sink = (elem_t) p;
+
+	printf ("%10lu", kb);
+	print_ratio (best [n_rows].cycles, loads);
+	printf ("\n");
+	n_rows++;
+    }
+
+    for (row = 0, kb = 1; row < n_rows; row++, kb *= 2) {
+	snprintf (name, sizeof (name), "chase_%luK", kb);
+	print_bench (name, best [row].cycles, best [row].instret);
+    }
+}
+
+// ================================================================
+// Strided reads over the whole MAX_KB working set
+
+static elem_t stride_reads (unsigned long stride, unsigned long passes)
+{
+    const char * const base  = (const char *) ARRAY_A;
+    const unsigned long bytes = MAX_KB * 1024UL;
+    unsigned long       off, pass;
+    elem_t              sum = 0;
+
+    for (pass = 0; pass < passes; pass++)
+	for (off = 0; off < bytes; off += stride)
+	    sum += * (const elem_t *) (base + off);
+    return sum;
+}
+
+static void run_stride (void)
+{
+    unsigned long stride, per_pass, passes, j;
+    int           rep, row, n_rows = 0;
+    sample_t      best [MAX_ROWS];
+    char          name [32];
+
+    for (j = 0; j < (MAX_KB * 1024UL) / sizeof (elem_t); j++)
+	ARRAY_A [j] = j;
+
+    printf ("\nStrided reads: cycles per access (%d KiB working set)\n", MAX_KB);
+    printf ("%10s %10s\n", "stride B", "cycles");
+
+    for (stride = sizeof (elem_t); stride <= MAX_STRIDE; stride *= 2) {
+	per_pass = (MAX_KB * 1024UL) / stride;
+	passes   = (per_pass < STRIDE_ACCESSES) ? (STRIDE_ACCESSES / per_pass) : 1;
+
+	best [n_rows].cycles = 0;
+	sink = stride_reads (stride, 1);    // warm-up
+	for (rep = 0; rep < NTIMES; rep++) {
+	    sample_t s0 = sample_start ();
+	    sink = stride_reads (stride, passes);
+	    best [n_rows] = sample_best (s0, best [n_rows]);
+	}
+
+	printf ("%10lu", stride);
+	print_ratio (best [n_rows].cycles, passes * per_pass);
+	printf ("\n");
+	n_rows++;
+    }
+
+    for (row = 0, stride = sizeof (elem_t); row < n_rows; row++, stride *= 2) {
+	snprintf (name, sizeof (name), "stride_%luB", stride);
+	print_bench (name, best [row].cycles, best [row].instret);
+    }
+}
+
+// ================================================================
+
+int main (int argc, char *argv[])
+{
+    printf ("membench: buffers at 0x%lx, up to %d KiB each\n", (unsigned long) BUF_BASE, MAX_KB);
+
+    run_stream ();
+    run_chase ();
+    run_stride ();
+
+    TEST_PASS
+    return 0;
+}
@@ -17,9 +17,14 @@
  * expressed or implied by its publication or distribution.
  **********************************************************************/
 
+#include <stdio.h>
 #include "inttypes.h"
 
+#include "riscv_counters.h"
+
+#ifndef NULL
 #define NULL  (void *) 0
+#endif
 
 
 typedef uint64_t datum;     /* Set the data bus width to 64 bits. */
@@ -233,6 +238,418 @@ memTestDevice(volatile datum * baseAddress, unsigned long nBytes)
 }   /* memTestDevice() */
 
 
+#ifdef MEMTEST_FAST
+
+/**********************************************************************
+ *
+ * Fast mode (build with -DMEMTEST_FAST, e.g. make MEMTEST_FLAGS=-DMEMTEST_FAST)
+ *
+ * Description: Screens a whole DDR range instead of a small window.
+ *              The range [MEMTEST_BASE, MEMTEST_BASE + MEMTEST_BYTES)
+ *              defaults to all of cached DDR; the tohost page and the
+ *              running program (from its load address up to the largest
+ *              of _end, the stack top and the heap's current break)
+ *              are skipped.
+ *
+ *              Memory is accessed one cache line at a time, with
+ *              XLEN-bit loads and stores unrolled across the line, and
+ *              is checked with moving inversions (fill ascending;
+ *              verify and invert ascending; verify and invert
+ *              descending; verify) of three patterns:
+ *                  address   each word holds its own address
+ *                  solid     all zeros, then all ones
+ *                  checker   0x55.., then 0xAA..
+ *              The address pattern finds aliasing anywhere in the
+ *              range; the others find stuck and coupled bits.
+ *
+ *              Each pass prints a '.' every PROGRESS_BYTES, then its
+ *              throughput in bytes/cycle and in MB/s at CLOCK_MHZ.
+ *              The first MAX_REPORTS bad words are printed.
+ *
+ * Notes:       In simulation, use a small range, e.g.
+ *                  -DMEMTEST_FAST -DMEMTEST_BYTES=0x200000
+ *              Ranges smaller than the data cache test the cache
+ *              rather than DDR.
+ *
+ **********************************************************************/
+
+#ifndef MEMTEST_BASE
+#define MEMTEST_BASE    0xC0000000ULL
+#endif
+
+#ifndef MEMTEST_BYTES
+#define MEMTEST_BYTES   0x40000000ULL
+#endif
+
+#ifndef CLOCK_MHZ
+#define CLOCK_MHZ       100
+#endif
+
+#ifndef PROGRESS_BYTES
+#define PROGRESS_BYTES  0x4000000ULL        /* 64 MiB */
+#endif
+
+#define MAX_REPORTS     16
+
+#define TOHOST_PAGE     0xBFFFF000ULL       /* see lib/bare.lds */
+#define PROGRAM_BASE    0xC0000000ULL       /* see lib/bare.lds */
+#define STACK_TOP       0xC00F0000ULL       /* see lib/startup.S */
+
+typedef unsigned long word;                 /* XLEN bits */
+
+#define LINE_BYTES      64
+#define LINE_WORDS      (LINE_BYTES / sizeof (word))
+#define ALIGN_UP(x,n)   (((x) + (n) - 1) & ~ (uint64_t) ((n) - 1))
+#define ALIGN_DOWN(x,n) ((x) & ~ (uint64_t) ((n) - 1))
+
+extern char _end [];
+extern void *_sbrk (int nbytes);
+
+typedef struct {
+    uint64_t lo, hi;        /* [lo, hi), line-aligned */
+} region;
+
+#define MAX_REGIONS     4
+
+static region        regions [MAX_REGIONS];
+static int           nRegions;
+static unsigned long nErrors;
+
+enum { OP_FILL, OP_VERIFY, OP_VERIFY_INVERT };
+
+
+/**********************************************************************
+ *
+ * Function:    fastRegions()
+ *
+ * Description: Splits the test range into regions[] around the
+ *              excluded windows.
+ *
+ **********************************************************************/
+static void
+fastRegions(void)
+{
+    uint64_t programTop = (uint64_t) (unsigned long) _end;
+    region   excluded [2];
+    uint64_t lo = ALIGN_UP (MEMTEST_BASE, LINE_BYTES);
+    uint64_t hi = ALIGN_DOWN (MEMTEST_BASE + MEMTEST_BYTES, LINE_BYTES);
+    int      i, j;
+
+    if (programTop < STACK_TOP)
+    {
+        programTop = STACK_TOP;
+    }
+    if (programTop < (uint64_t) (unsigned long) _sbrk (0))
+    {
+        programTop = (uint64_t) (unsigned long) _sbrk (0);
+    }
+    excluded[0].lo = TOHOST_PAGE;
+    excluded[0].hi = TOHOST_PAGE + 0x1000;
+    excluded[1].lo = PROGRAM_BASE;
+    excluded[1].hi = ALIGN_UP (programTop, 0x1000);
+
+    nRegions = 0;
+    if (lo < hi)
+    {
+        regions[nRegions].lo = lo;
+        regions[nRegions].hi = hi;
+        nRegions++;
+    }
+
+    /*
+     * Cut each excluded window out of every region (ascending order).
+     */
+    for (i = 0; i < 2; i++)
+    {
+        for (j = 0; j < nRegions; j++)
+        {
+            region r = regions[j];
+
+            if ((excluded[i].hi <= r.lo) || (r.hi <= excluded[i].lo))
+            {
+                continue;
+            }
+            if ((r.lo < excluded[i].lo) && (excluded[i].hi < r.hi))
+            {
+                int k;
+                for (k = nRegions; k > j + 1; k--)
+                {
+                    regions[k] = regions[k - 1];
+                }
+                regions[j].hi     = excluded[i].lo;
+                regions[j + 1].lo = excluded[i].hi;
+                regions[j + 1].hi = r.hi;
+                nRegions++;
+                j++;
+            }
+            else if (r.lo < excluded[i].lo)
+            {
+                regions[j].hi = excluded[i].lo;
+            }
+            else if (excluded[i].hi < r.hi)
+            {
+                regions[j].lo = excluded[i].hi;
+            }
+            else
+            {
+                int k;
+                for (k = j; k < nRegions - 1; k++)
+                {
+                    regions[k] = regions[k + 1];
+                }
+                nRegions--;
+                j--;
+            }
+        }
+    }
+
+}   /* fastRegions() */
+
+
+/**********************************************************************
+ *
+ * Function:    fastReport()
+ *
+ * Description: Reports the bad words of a line whose check failed.
+ *              'x' holds the values read from the line at 'addr'.
+ *
+ **********************************************************************/
+static void
+fastReport(const word * x, word addr, word addrMask, word pattern)
+{
+    unsigned k;
+
+    for (k = 0; k < LINE_WORDS; k++)
+    {
+        word a        = addr + k * sizeof (word);
+        word expected = (a & addrMask) ^ pattern;
+
+        if (x[k] != expected)
+        {
+            if (nErrors < MAX_REPORTS)
+            {
+                printf ("\n    ERROR at 0x%08lx: expected 0x%0*lx, read 0x%0*lx\n    ",
+                        a, (int) (2 * sizeof (word)), expected,
+                        (int) (2 * sizeof (word)), x[k]);
+            }
+            nErrors++;
+        }
+    }
+
+}   /* fastReport() */
+
+
+/**********************************************************************
+ *
+ * Function:    fastLines()
+ *
+ * Description: Performs one operation on the lines of [lo, hi), in
+ *              ascending or descending order.  The value expected in
+ *              the word at address a is ((a & addrMask) ^ pattern):
+ *                  OP_FILL           write the expected values
+ *                  OP_VERIFY         check the expected values
+ *                  OP_VERIFY_INVERT  check them, then write their
+ *                                    complements
+ *
+ **********************************************************************/
+static void
+fastLines(int op, uint64_t lo, uint64_t hi, word addrMask, word pattern, int descending)
+{
+    uint64_t nLines = (hi - lo) / LINE_BYTES;
+    uint64_t n;
+    long     step   = descending ? - (long) LINE_BYTES : (long) LINE_BYTES;
+    word     addr   = (word) (descending ? (hi - LINE_BYTES) : lo);
+    word     x [LINE_WORDS];
+    word     diff;
+    unsigned k;
+
+    for (n = 0; n < nLines; n++, addr += step)
+    {
+        volatile word * p = (volatile word *) addr;
+
+        switch (op)
+        {
+        case OP_FILL:
+#pragma GCC unroll 16
+            for (k = 0; k < LINE_WORDS; k++)
+            {
+                p[k] = ((addr + k * sizeof (word)) & addrMask) ^ pattern;
+            }
+            break;
+
+        case OP_VERIFY:
+        case OP_VERIFY_INVERT:
+            diff = 0;
+#pragma GCC unroll 16
+            for (k = 0; k < LINE_WORDS; k++)
+            {
+                x[k]  = p[k];
+                diff |= x[k] ^ (((addr + k * sizeof (word)) & addrMask) ^ pattern);
+            }
+            if (diff != 0)
+            {
+                fastReport (x, addr, addrMask, pattern);
+            }
+            if (op == OP_VERIFY_INVERT)
+            {
+#pragma GCC unroll 16
+                for (k = 0; k < LINE_WORDS; k++)
+                {
+                    p[k] = ~ (((addr + k * sizeof (word)) & addrMask) ^ pattern);
+                }
+            }
+            break;
+        }
+    }
+
+}   /* fastLines() */
+
+
+/**********************************************************************
+ *
+ * Function:    fastPass()
+ *
+ * Description: Performs one operation (see fastLines()) over all the
+ *              regions, printing progress and throughput.
+ *
+ **********************************************************************/
+static void
+fastPass(const char * name, int op, word addrMask, word pattern, int descending)
+{
+    uint64_t bytes = 0;
+    uint64_t traffic;
+    uint64_t cycles;
+    uint64_t milli;
+    int      i, r;
+
+    printf ("  %-28s ", name);
+    cycles = read_cycle ();
+
+    for (i = 0; i < nRegions; i++)
+    {
+        region   reg = regions[descending ? (nRegions - 1 - i) : i];
+        uint64_t chunk;
+
+        for (r = 0; reg.lo + (uint64_t) r * PROGRESS_BYTES < reg.hi; r++)
+        {
+            uint64_t lo = reg.lo + (uint64_t) r * PROGRESS_BYTES;
+            uint64_t hi = (reg.hi - lo > PROGRESS_BYTES) ? (lo + PROGRESS_BYTES) : reg.hi;
+
+            if (descending)
+            {
+                hi = reg.hi - (uint64_t) r * PROGRESS_BYTES;
+                lo = (hi - reg.lo > PROGRESS_BYTES) ? (hi - PROGRESS_BYTES) : reg.lo;
+            }
+            chunk = hi - lo;
+            fastLines (op, lo, hi, addrMask, pattern, descending);
+            bytes += chunk;
+            printf (".");
+        }
+    }
+
+    cycles  = read_cycle () - cycles;
+    traffic = (op == OP_VERIFY_INVERT) ? (2 * bytes) : bytes;
+    milli   = (cycles == 0) ? 0 : ((traffic * 1000) / cycles);
+    printf (" %llu MiB, %llu.%03llu B/cycle, %llu MB/s at %d MHz\n",
+            (unsigned long long) (bytes >> 20),
+            (unsigned long long) (milli / 1000), (unsigned long long) (milli % 1000),
+            (unsigned long long) ((cycles == 0) ? 0 : ((traffic * CLOCK_MHZ) / cycles)),
+            CLOCK_MHZ);
+
+}   /* fastPass() */
+
+
+/**********************************************************************
+ *
+ * Function:    memTestFast()
+ *
+ * Description: Runs the moving-inversions test with each pattern over
+ *              all the regions.
+ *
+ * Returns:     The number of bad words read.
+ *
+ **********************************************************************/
+static unsigned long
+memTestFast(void)
+{
+    static const struct {
+        const char * name;
+        word         addrMask;
+        word         pattern;
+    } tests[] = {
+        { "address", ~ (word) 0, 0 },
+        { "solid",   0,          0 },
+        { "checker", 0,          (word) 0x5555555555555555ULL },
+    };
+    char     name[32];
+    unsigned t;
+
+    nErrors = 0;
+    for (t = 0; t < sizeof (tests) / sizeof (tests[0]); t++)
+    {
+        word m = tests[t].addrMask;
+        word p = tests[t].pattern;
+
+        snprintf (name, sizeof (name), "%s fill", tests[t].name);
+        fastPass (name, OP_FILL, m, p, 0);
+        snprintf (name, sizeof (name), "%s verify/invert up", tests[t].name);
+        fastPass (name, OP_VERIFY_INVERT, m, p, 0);
+        snprintf (name, sizeof (name), "%s verify/invert down", tests[t].name);
+        fastPass (name, OP_VERIFY_INVERT, m, ~ p, 1);
+        snprintf (name, sizeof (name), "%s verify", tests[t].name);
+        fastPass (name, OP_VERIFY, m, p, 0);
+    }
+
+    return (nErrors);
+
+}   /* memTestFast() */
+
+
+/**********************************************************************
+ *
+ * Function:    main()
+ *
+ * Description: Test all of DDR except the current program.
+ *
+ * Returns:     0 on success.
+ *              Otherwise -1 indicates failure.
+ *
+ **********************************************************************/
+int
+main(void)
+{
+    uint64_t total = 0;
+    int      i;
+
+    fastRegions ();
+    printf ("memtest: fast mode, %d bytes per line access\n", LINE_BYTES);
+    for (i = 0; i < nRegions; i++)
+    {
+        printf ("  range 0x%08llx - 0x%08llx\n",
+                (unsigned long long) regions[i].lo, (unsigned long long) regions[i].hi);
+        total += regions[i].hi - regions[i].lo;
+    }
+    printf ("  total %llu MiB\n", (unsigned long long) (total >> 20));
+
+    if ((nRegions == 0) ||
+        (memTestDataBus((volatile datum *) (unsigned long) regions[0].lo) != 0) ||
+        (memTestFast() != 0))
+    {
+        printf ("memtest: FAIL (%lu bad words)\n", nErrors);
+        TEST_FAIL
+        return (-1);
+    }
+    else
+    {
+        printf ("memtest: PASS\n");
+        TEST_PASS
+        return (0);
+    }
+
+}   /* main() */
+
+#else
+
 /**********************************************************************
  *
  * Function:    main()
@@ -253,14 +670,18 @@ main(void)
         (memTestDevice(BASE_ADDRESS, NUM_BYTES) != NULL))
     {
         //toggleLed(LED_RED);
+        TEST_FAIL
 
         return (-1);
     }
     else
     {
         //toggleLed(LED_GREEN);
+        TEST_PASS
 
         return (0);
     }
 
 }   /* main() */
+
+#endif /* MEMTEST_FAST */
@@ -242,6 +242,8 @@ int main ( void )
     PARANOIA tests the floating point arithmetic implementation on a computer.
 */
 {
+  uint64_t cycles0  = read_cycle ();
+  uint64_t instret0 = read_instret ();
 /*
   First two assignments use integer right-hand sides.
 */
@@ -1828,6 +1830,8 @@ the system traps on overflow.\n");
   printf ( "PARANOIA:\n" );
   printf ( "  Normal end of execution.\n" );
 
+  print_bench ( "paranoia", read_cycle () - cycles0, read_instret () - instret0 );
+
   if (paranoia_is_pass == 1) {
       TEST_PASS
   } else {
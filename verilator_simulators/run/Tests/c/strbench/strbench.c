@@ -0,0 +1,242 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// strbench: checks and times the word-wise memcpy, memset, memcmp and
+// strlen of lib/string.c.
+//
+// The check compares each routine against a byte-at-a-time reference,
+// for every source and destination alignment within a word and for all
+// sizes up to MAX_CHECK_BYTES, and verifies that bytes around the
+// destination are untouched.
+//
+// The benchmark times each routine and its byte-at-a-time reference on
+// aligned and misaligned buffers of a few sizes, reporting BENCH lines
+// (see riscv_counters.h) named <routine>_<size>[_u] for lib/string.c and
+// ref_<routine>_<size>[_u] for the reference; _u marks a misaligned
+// source (or second operand).
+//
+// Built with -fno-builtin (see the Makefile), so that the calls below go
+// to the library and the reference loops stay loops.
+// ================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "riscv_counters.h"
+
+#define W                sizeof (unsigned long)
+#define MAX_CHECK_BYTES  (10 * W + 3)
+#define GUARD            16
+#define NTIMES           2
+
+// Big enough for the largest benchmark size plus misalignment
+#define BUF_BYTES        4200
+
+static unsigned char src [BUF_BYTES] __attribute__ ((aligned (64)));
+static unsigned char dst [BUF_BYTES] __attribute__ ((aligned (64)));
+static unsigned char expect [BUF_BYTES] __attribute__ ((aligned (64)));
+
+// ================================================================
+// Byte-at-a-time references
+
+static void *ref_memcpy (void *d, const void *s, size_t n)
+{
+    unsigned char       *dp = d;
+    const unsigned char *sp = s;
+
+    while (n-- > 0)
+	*dp++ = *sp++;
+    return d;
+}
+
+static void *ref_memset (void *d, int c, size_t n)
+{
+    unsigned char *dp = d;
+
+    while (n-- > 0)
+	*dp++ = (unsigned char) c;
+    return d;
+}
+
+static int ref_memcmp (const void *a, const void *b, size_t n)
+{
+    const unsigned char *ap = a, *bp = b;
+
+    for (; n > 0; n--, ap++, bp++)
+	if (*ap != *bp)
+	    return *ap - *bp;
+    return 0;
+}
+
+static size_t ref_strlen (const char *s)
+{
+    const char *p = s;
+
+    while (*p != 0)
+	p++;
+    return p - s;
+}
+
+static int sign (int x)
+{
+    return (x > 0) - (x < 0);
+}
+
+static void fill (unsigned char *buf, size_t n, unsigned seed)
+{
+    size_t j;
+
+    for (j = 0; j < n; j++)
+	buf [j] = (unsigned char) ((j * 131) + seed + 1);
+}
+
+// ================================================================
+// Correctness
+
+static int check (void)
+{
+    size_t so, dso, n, j;
+    int    errors = 0;
+
+    for (so = 0; so < W; so++)
+	for (dso = 0; dso < W; dso++)
+	    for (n = 0; n <= MAX_CHECK_BYTES; n++) {
+		unsigned char *d = dst + GUARD + dso;
+		unsigned char *e = expect + GUARD + dso;
+		unsigned char *s = src + GUARD + so;
+
+		// memcpy
+		fill (src, BUF_BYTES, 7);
+		fill (dst, BUF_BYTES, 3);
+		fill (expect, BUF_BYTES, 3);
+		ref_memcpy (e, s, n);
+		if ((memcpy (d, s, n) != d) || (ref_memcmp (dst, expect, n + 2 * GUARD + W) != 0)) {
+		    printf ("memcpy: error, src+%u dst+%u size %u\n", (unsigned) so, (unsigned) dso, (unsigned) n);
+		    errors++;
+		}
+
+		// memset
+		ref_memset (e, 0xA5, n);
+		if ((memset (d, 0xA5, n) != d) || (ref_memcmp (dst, expect, n + 2 * GUARD + W) != 0)) {
+		    printf ("memset: error, dst+%u size %u\n", (unsigned) dso, (unsigned) n);
+		    errors++;
+		}
+
+		// memcmp: equal, then differing in the first, middle and last byte
+		ref_memcpy (d, s, n);
+		if (memcmp (d, s, n) != 0) {
+		    printf ("memcmp: error, equal, src+%u dst+%u size %u\n", (unsigned) so, (unsigned) dso, (unsigned) n);
+		    errors++;
+		}
+		for (j = 0; (n > 0) && (j < 3); j++) {
+		    size_t k = (j == 0) ? 0 : ((j == 1) ? n / 2 : n - 1);
+
+		    d [k] ^= (unsigned char) (0x80 >> j);
+		    if (sign (memcmp (d, s, n)) != sign (ref_memcmp (d, s, n))) {
+			printf ("memcmp: error, byte %u, src+%u dst+%u size %u\n",
+				(unsigned) k, (unsigned) so, (unsigned) dso, (unsigned) n);
+			errors++;
+		    }
+		    d [k] ^= (unsigned char) (0x80 >> j);
+		}
+
+		// strlen (string at the source alignment, followed by non-zero bytes)
+		ref_memset (src, 'x', BUF_BYTES);
+		s [n] = 0;
+		if (strlen ((const char *) s) != n) {
+		    printf ("strlen: error, src+%u size %u\n", (unsigned) so, (unsigned) n);
+		    errors++;
+		}
+	    }
+
+    printf ("strbench: check: %d error(s), alignments 0..%u, sizes 0..%u\n",
+	    errors, (unsigned) (W - 1), (unsigned) MAX_CHECK_BYTES);
+    return errors;
+}
+
+// ================================================================
+// Benchmark
+
+typedef enum { OP_MEMCPY, OP_MEMSET, OP_MEMCMP, OP_STRLEN, N_OPS } op_t;
+
+static const char *op_names [N_OPS] = {"memcpy", "memset", "memcmp", "strlen"};
+
+static const size_t bench_sizes [] = {16, 256, 4096};
+
+#define N_SIZES  (sizeof (bench_sizes) / sizeof (bench_sizes [0]))
+
+volatile size_t sink;
+
+static void run_op (op_t op, int ref, unsigned char *s, unsigned char *d, size_t n)
+{
+    switch (op) {
+    case OP_MEMCPY: if (ref) ref_memcpy (d, s, n);                  else memcpy (d, s, n);                  break;
+    case OP_MEMSET: if (ref) ref_memset (d, 0, n);                  else memset (d, 0, n);                  break;
+    case OP_MEMCMP: sink = ref ? ref_memcmp (d, s, n)               : memcmp (d, s, n);                     break;
+    case OP_STRLEN: sink = ref ? ref_strlen ((const char *) s)      : strlen ((const char *) s);            break;
+    default: break;
+    }
+}
+
+static void bench (void)
+{
+    unsigned  op, sz, misaligned, ref, rep;
+    char      name [40];
+
+    printf ("\n%-8s %6s %5s %12s %12s\n", "routine", "bytes", "align", "lib cycles", "byte cycles");
+    for (op = 0; op < N_OPS; op++)
+	for (sz = 0; sz < N_SIZES; sz++)
+	    for (misaligned = 0; misaligned < 2; misaligned++) {
+		size_t         n = bench_sizes [sz];
+		unsigned char *s = src + (misaligned ? 3 : 0);
+		uint64_t       cycles [2], instret [2];
+
+		// Operands compare equal to the end; the string is n bytes long
+		ref_memset (src, 'x', BUF_BYTES);
+		ref_memset (dst, 'x', BUF_BYTES);
+		s [n] = 0;
+		dst [n] = 0;
+
+		for (ref = 0; ref < 2; ref++) {
+		    cycles [ref] = 0;
+		    run_op (op, ref, s, dst, n);    // warm-up
+		    for (rep = 0; rep < NTIMES; rep++) {
+			uint64_t i0 = read_instret ();
+			uint64_t c0 = read_cycle ();
+			run_op (op, ref, s, dst, n);
+			uint64_t c1 = read_cycle () - c0;
+			uint64_t i1 = read_instret () - i0;
+			if ((cycles [ref] == 0) || (c1 < cycles [ref])) {
+			    cycles [ref]  = c1;
+			    instret [ref] = i1;
+			}
+		    }
+		}
+
+		printf ("%-8s %6u %5s %12llu %12llu\n", op_names [op], (unsigned) n,
+			misaligned ? "+3" : "0",
+			(unsigned long long) cycles [0], (unsigned long long) cycles [1]);
+		snprintf (name, sizeof (name), "%s_%u%s", op_names [op], (unsigned) n, misaligned ? "_u" : "");
+		print_bench (name, cycles [0], instret [0]);
+		snprintf (name, sizeof (name), "ref_%s_%u%s", op_names [op], (unsigned) n, misaligned ? "_u" : "");
+		print_bench (name, cycles [1], instret [1]);
+	    }
+}
+
+// ================================================================
+
+int main (int argc, char *argv[])
+{
+    int errors = check ();
+
+    bench ();
+
+    if (errors == 0) {
+	TEST_PASS
+    }
+    else {
+	TEST_FAIL
+    }
+    return 0;
+}
@@ -0,0 +1,359 @@
+// Copyright (c) 2019 Bluespec, Inc.  All Rights Reserved
+
+// ================================================================
+// traplat: trap and interrupt latency benchmark.
+//
+// Installs a minimal trap handler (trap_entry, below) that reads the
+// cycle counter as its first instruction, and measures, in cycles:
+//     ecall entry      rdcycle before ecall     -> handler entry
+//     misaligned entry rdcycle before a misaligned load -> handler entry
+//                      (reported as "no trap" if the core handles
+//                      misaligned loads in hardware)
+//     mret             rdcycle before mret      -> first instruction after
+//     timer entry      last rdcycle before the interrupt -> handler entry
+//                      (mtimecmp set a little ahead of mtime)
+//     uart rx entry    time RX data was seen ready (or the last poll before
+//                      it was) -> handler entry, through the PLIC; the UART
+//                      is put in loopback mode and sends itself one byte
+// The timer and UART figures have the resolution of one iteration of the
+// polling loop (for the UART, that includes an uncached LSR read).  If the
+// interrupt is taken at the loop's rdcycle, that rdcycle is executed again
+// after mret, and its time is later than the handler's entry; the loop
+// therefore also keeps the previous poll's time, which is used instead.
+//
+// Each measurement is repeated N_ITER times and reported as min, median
+// and max.  If an interrupt does not arrive within TIMEOUT polling
+// iterations (e.g. a UART model without loopback in simulation), that
+// row is reported as a timeout.
+//
+// The handler uses only t4, t5 and t6, which every measurement's inline
+// asm declares clobbered; it leaves the entry time in t6 and the time just
+// before mret in t5.  Synchronous traps resume after the trapping
+// instruction; interrupts are acknowledged by clearing their bit in mie.
+// ================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "riscv_counters.h"
+#include "ns16550.h"
+
+#ifndef N_ITER
+#define N_ITER   64
+#endif
+
+#ifndef TIMEOUT
+#define TIMEOUT  100000
+#endif
+
+// Timer interrupt: mtimecmp is set this many mtime ticks ahead
+#ifndef TIMER_DELTA
+#define TIMER_DELTA  50
+#endif
+
+// GFE memory map
+#define CLINT_BASE        0x10000000ULL
+#define CLINT_MTIMECMP    (CLINT_BASE + 0x4000)
+#define CLINT_MTIME       (CLINT_BASE + 0xBFF8)
+
+#define PLIC_BASE         0x0C000000ULL
+#define PLIC_PRIORITY     (PLIC_BASE + 0x0000)
+#define PLIC_ENABLE       (PLIC_BASE + 0x2000)
+#define PLIC_THRESHOLD    (PLIC_BASE + 0x200000)
+#define PLIC_CLAIM        (PLIC_BASE + 0x200004)
+
+#ifndef UART_PLIC_SOURCE
+#define UART_PLIC_SOURCE  1
+#endif
+
+#define UART_BASE         0x62300000ULL
+#define UART_RBR          (UART_BASE + 0x00)
+#define UART_THR          (UART_BASE + 0x00)
+#define UART_IER          (UART_BASE + 0x04)
+#define UART_MCR          (UART_BASE + 0x10)
+#define UART_LSR          (UART_BASE + 0x14)
+
+#define UART_IER_ERBI     0x01
+#define UART_MCR_LOOP     0x10
+#define UART_LSR_DR       0x01
+
+#define MSTATUS_MIE       0x8
+#define MIE_MTIE          0x80
+#define MIE_MEIE          0x800
+
+typedef unsigned long  reg_t;    // XLEN bits, as read by rdcycle
+
+// ================================================================
+// The trap handler
+
+extern void trap_entry (void);
+
+asm (".text\n"
+     ".align 2\n"
+     ".globl trap_entry\n"
+     "trap_entry:\n"
+     "    rdcycle t6\n"
+     "    csrr    t5, mcause\n"
+     "    bgez    t5, 1f\n"
+     // Interrupt: disable it (cause = bit number in mie)
+     "    li      t4, 1\n"
+     "    sll     t4, t4, t5\n"
+     "    csrc    mie, t4\n"
+     "    j       2f\n"
+     // Exception: resume after the (uncompressed) trapping instruction
+     "1:  csrr    t4, mepc\n"
+     "    addi    t4, t4, 4\n"
+     "    csrw    mepc, t4\n"
+     "2:  rdcycle t5\n"
+     "    mret\n");
+
+// ================================================================
+// Help functions
+
+static reg_t csr_swap_mtvec (reg_t x)
+{
+    reg_t old;
+
+    asm volatile ("csrrw %0, mtvec, %1" : "=r" (old) : "r" (x));
+    return old;
+}
+
+static void csr_set_mie (reg_t x)
+{
+    asm volatile ("csrs mie, %0" : : "r" (x));
+}
+
+static void csr_clear_mie (reg_t x)
+{
+    asm volatile ("csrc mie, %0" : : "r" (x));
+}
+
+// Latency of an interrupt taken at t_entry, from the last poll before it:
+// t_last, unless the interrupt was taken at the rdcycle that read t_last
+// (re-executed after mret, so later than t_entry), then t_prev
+static int poll_latency (reg_t t_prev, reg_t t_last, reg_t t_entry, uint32_t *latency)
+{
+    if ((long) (t_entry - t_last) >= 0)
+	*latency = t_entry - t_last;
+    else if ((long) (t_entry - t_prev) >= 0)
+	*latency = t_entry - t_prev;
+    else
+	return 0;
+    return 1;
+}
+
+static void csr_set_mstatus (reg_t x)
+{
+    asm volatile ("csrs mstatus, %0" : : "r" (x));
+}
+
+static uint64_t read_mtime (void)
+{
+    uint32_t hi, lo;
+
+    do {
+	hi = io_read32 (CLINT_MTIME + 4);
+	lo = io_read32 (CLINT_MTIME);
+    } while (hi != io_read32 (CLINT_MTIME + 4));
+    return (((uint64_t) hi) << 32) | lo;
+}
+
+// Written high word first, so that it never passes through a value
+// below mtime on RV32
+static void write_mtimecmp (uint64_t x)
+{
+    io_write32 (CLINT_MTIMECMP + 4, 0xFFFFFFFF);
+    io_write32 (CLINT_MTIMECMP,     (uint32_t) x);
+    io_write32 (CLINT_MTIMECMP + 4, (uint32_t) (x >> 32));
+}
+
+// Prints min/median/max of n samples (sorts them); n == 0 means timeout
+static void report (const char *name, uint32_t *samples, int n)
+{
+    int i, j;
+
+    if (n == 0) {
+	printf ("%-18s %10s\n", name, "timeout");
+	return;
+    }
+    for (i = 1; i < n; i++) {
+	uint32_t x = samples [i];
+	for (j = i - 1; (j >= 0) && (samples [j] > x); j--)
+	    samples [j + 1] = samples [j];
+	samples [j + 1] = x;
+    }
+    printf ("%-18s %10u %10u %10u\n", name,
+	    (unsigned) samples [0], (unsigned) samples [n / 2], (unsigned) samples [n - 1]);
+}
+
+// ================================================================
+// Measurements
+
+static uint32_t s_ecall [N_ITER], s_mret [N_ITER], s_misaligned [N_ITER];
+static uint32_t s_timer [N_ITER], s_uart [N_ITER];
+
+static void measure_ecall (int i)
+{
+    reg_t t_before, t_after, t_entry, t_mret;
+
+    asm volatile (".option push\n"
+		  ".option norvc\n"
+		  "rdcycle %0\n"
+		  "ecall\n"
+		  "rdcycle %1\n"
+		  "mv      %2, t6\n"
+		  "mv      %3, t5\n"
+		  ".option pop\n"
+		  : "=&r" (t_before), "=&r" (t_after), "=&r" (t_entry), "=&r" (t_mret)
+		  :
+		  : "t4", "t5", "t6", "memory");
+    s_ecall [i] = t_entry - t_before;
+    s_mret  [i] = t_after - t_mret;
+}
+
+// Returns 0 if the load did not trap
+static int measure_misaligned (int i)
+{
+    static uint32_t buf [2];
+    reg_t           t_before, t_entry, x;
+
+    asm volatile (".option push\n"
+		  ".option norvc\n"
+		  "li      t6, 0\n"
+		  "rdcycle %0\n"
+		  "lw      %2, 1(%3)\n"
+		  "mv      %1, t6\n"
+		  ".option pop\n"
+		  : "=&r" (t_before), "=&r" (t_entry), "=&r" (x)
+		  : "r" (buf)
+		  : "t4", "t5", "t6", "memory");
+    if (t_entry == 0)
+	return 0;
+    s_misaligned [i] = t_entry - t_before;
+    return 1;
+}
+
+// Returns 0 on timeout, or if no poll time precedes the entry
+static int measure_timer (int i)
+{
+    reg_t t_prev, t_last, t_entry, count;
+
+    write_mtimecmp (read_mtime () + TIMER_DELTA);
+    asm volatile ("li      t6, 0\n"
+		  "li      %3, %4\n"
+		  "rdcycle %1\n"
+		  "csrs    mie, %5\n"
+		  "1: mv   %0, %1\n"
+		  "rdcycle %1\n"
+		  "bnez    t6, 2f\n"
+		  "addi    %3, %3, -1\n"
+		  "bnez    %3, 1b\n"
+		  "2: mv   %2, t6\n"
+		  : "=&r" (t_prev), "=&r" (t_last), "=&r" (t_entry), "=&r" (count)
+		  : "i" (TIMEOUT), "r" ((reg_t) MIE_MTIE)
+		  : "t4", "t5", "t6", "memory");
+    csr_clear_mie (MIE_MTIE);
+    write_mtimecmp (~ (uint64_t) 0);
+    if (t_entry == 0)
+	return 0;
+    return poll_latency (t_prev, t_last, t_entry, & s_timer [i]);
+}
+
+// Returns 0 on timeout, or if no poll time precedes the entry
+static int measure_uart (int i)
+{
+    reg_t t_prev, t_ready, t_entry, count, lsr;
+
+    asm volatile ("li      t6, 0\n"
+		  "li      %3, %5\n"
+		  "rdcycle %1\n"
+		  "csrs    mie, %6\n"
+		  "sw      %7, 0(%8)\n"            // THR: send one byte to ourselves
+		  // Poll until the interrupt arrives or RX data is seen
+		  "1: mv   %0, %1\n"
+		  "rdcycle %1\n"
+		  "lw      %4, 0x14(%8)\n"         // LSR
+		  "bnez    t6, 3f\n"
+		  "andi    %4, %4, %9\n"
+		  "bnez    %4, 2f\n"
+		  "addi    %3, %3, -1\n"
+		  "bnez    %3, 1b\n"
+		  "j       3f\n"
+		  // RX data seen at %1: wait for the interrupt
+		  "2: bnez t6, 3f\n"
+		  "addi    %3, %3, -1\n"
+		  "bnez    %3, 2b\n"
+		  "3: mv   %2, t6\n"
+		  : "=&r" (t_prev), "=&r" (t_ready), "=&r" (t_entry), "=&r" (count), "=&r" (lsr)
+		  : "i" (TIMEOUT), "r" ((reg_t) MIE_MEIE), "r" ((reg_t) 0x5A),
+		    "r" ((reg_t) UART_BASE), "i" (UART_LSR_DR)
+		  : "t4", "t5", "t6", "memory");
+    csr_clear_mie (MIE_MEIE);
+
+    // Drain RX, then claim and complete the interrupt at the PLIC
+    while (io_read32 (UART_LSR) & UART_LSR_DR)
+	(void) io_read32 (UART_RBR);
+    io_write32 (PLIC_CLAIM, io_read32 (PLIC_CLAIM));
+
+    if (t_entry == 0)
+	return 0;
+    return poll_latency (t_prev, t_ready, t_entry, & s_uart [i]);
+}
+
+// ================================================================
+
+int main (int argc, char *argv[])
+{
+    reg_t    old_mtvec;
+    uint32_t old_mcr;
+    int      i, n_misaligned = 0, n_timer = 0, n_uart = 0;
+
+    printf ("traplat: trap and interrupt latency in cycles, %d samples each\n", N_ITER);
+
+    write_mtimecmp (~ (uint64_t) 0);
+    old_mtvec = csr_swap_mtvec ((reg_t) trap_entry);
+    csr_set_mstatus (MSTATUS_MIE);
+
+    for (i = 0; i < N_ITER; i++) {
+	measure_ecall (i);
+	n_misaligned += measure_misaligned (n_misaligned);
+	n_timer      += measure_timer (n_timer);
+    }
+
+    // UART RX: loopback mode, RX-data interrupt through the PLIC.
+    // Console output must be flushed first, and no printf until the
+    // UART is back in normal mode.
+    ns16550_flush ();
+    old_mcr = io_read32 (UART_MCR);
+    io_write32 (UART_MCR, old_mcr | UART_MCR_LOOP);
+    while (io_read32 (UART_LSR) & UART_LSR_DR)
+	(void) io_read32 (UART_RBR);
+    io_write32 (PLIC_PRIORITY + 4 * UART_PLIC_SOURCE, 1);
+    io_write32 (PLIC_ENABLE + 4 * (UART_PLIC_SOURCE / 32),
+		io_read32 (PLIC_ENABLE + 4 * (UART_PLIC_SOURCE / 32)) | (1u << (UART_PLIC_SOURCE % 32)));
+    io_write32 (PLIC_THRESHOLD, 0);
+    io_write32 (UART_IER, UART_IER_ERBI);
+
+    for (i = 0; i < N_ITER; i++)
+	if (measure_uart (n_uart))
+	    n_uart++;
+	else
+	    break;
+
+    io_write32 (UART_IER, 0);
+    io_write32 (UART_MCR, old_mcr);
+    csr_swap_mtvec (old_mtvec);
+
+    printf ("%-18s %10s %10s %10s\n", "", "min", "median", "max");
+    report ("ecall entry",      s_ecall, N_ITER);
+    report ("mret",             s_mret,  N_ITER);
+    if (n_misaligned == 0)
+	printf ("%-18s %10s\n", "misaligned entry", "no trap");
+    else
+	report ("misaligned entry", s_misaligned, n_misaligned);
+    report ("timer entry",      s_timer, n_timer);
+    report ("uart rx entry",    s_uart,  n_uart);
+
+    TEST_PASS
+    return 0;
+}
@@ -45,6 +45,20 @@
 
 // Functions for console I/O
 
+uint64_t sim_io_activity = 0;
+
+uint64_t sim_instret       = 0;
+int      sim_instret_valid = 0;
+
+// ================================================================
+// c_set_instret ()
+
+void c_set_instret (uint64_t instret)
+{
+    sim_instret       = instret;
+    sim_instret_valid = 1;
+}
+
 // ================================================================
 // c_trygetchar()
 // Returns next input character (ASCII code) from the console.
@@ -74,6 +88,7 @@ uint8_t c_trygetchar (uint8_t  dummy)
 
     n = read (fd_stdin, & ch, 1);
     if (n == 1) {
+	sim_io_activity++;
 	return ch;
     }
     else {
@@ -127,6 +142,7 @@ uint32_t c_putchar (uint8_t ch)
     int      status;
     uint32_t success = 0;
 
+    sim_io_activity++;
     if ((ch == 0) || (ch > 0x7F)) {
 	// Discard non-printables
 	success = 1;
@@ -657,6 +673,7 @@ uint64_t c_debug_client_request_recv (uint8_t dummy)
 	}
     }
     p_result [7] = DMI_STATUS_OK;
+    sim_io_activity++;
 
     if (logfile_fp != NULL) {
 	uint8_t  op   = (result         & 0xFF);
@@ -823,3 +840,96 @@ int main (int argc, char *argv [])
 // ****************************************************************
 // ****************************************************************
 // ****************************************************************
+
+// Functions for boot ROM and flash contents (Verilog_RTL/DPI_ROM/)
+
+// ================================================================
+// Each ROM holds just the bytes of its file; everything else reads as
+// 0xAA, like the entries missing from the generated 'case' tables.
+
+#define N_ROMS  2
+
+typedef struct {
+    uint8_t  *bytes;
+    uint64_t  offset;
+    uint64_t  size;
+} rom_t;
+
+static rom_t roms [N_ROMS];
+
+// ================================================================
+// c_rom_load ()
+
+uint32_t c_rom_load (uint32_t rom, const char *filename, uint64_t offset)
+{
+    FILE     *fp;
+    long      size;
+    uint8_t  *bytes;
+
+    if (rom >= N_ROMS) {
+	fprintf (stderr, "ERROR: c_rom_load: no ROM %u\n", rom);
+	return 0;
+    }
+
+    fp = fopen (filename, "rb");
+    if (fp == NULL) {
+	fprintf (stderr, "ERROR: c_rom_load: could not open file: %s\n", filename);
+	return 0;
+    }
+    if ((fseek (fp, 0, SEEK_END) != 0) || ((size = ftell (fp)) < 0) || (fseek (fp, 0, SEEK_SET) != 0)) {
+	fprintf (stderr, "ERROR: c_rom_load: could not size file: %s\n", filename);
+	fclose (fp);
+	return 0;
+    }
+
+    bytes = (uint8_t *) malloc ((size > 0) ? size : 1);
+    if (bytes == NULL) {
+	fprintf (stderr, "ERROR: c_rom_load: could not allocate %ld bytes for %s\n", size, filename);
+	fclose (fp);
+	return 0;
+    }
+    if (fread (bytes, 1, size, fp) != (size_t) size) {
+	fprintf (stderr, "ERROR: c_rom_load: could not read file: %s\n", filename);
+	free (bytes);
+	fclose (fp);
+	return 0;
+    }
+    fclose (fp);
+
+    free (roms [rom].bytes);
+    roms [rom].bytes  = bytes;
+    roms [rom].offset = offset;
+    roms [rom].size   = size;
+
+    fprintf (stdout, "INFO: ROM %u: loaded %ld bytes from %s at offset 0x%" PRIx64 "\n",
+	     rom, size, filename, offset);
+    return 1;
+}
+
+// ================================================================
+// c_rom_read ()
+
+uint64_t c_rom_read (uint32_t rom, uint64_t offset)
+{
+    uint64_t  x = 0;
+    rom_t    *r;
+    int       j;
+
+    if (rom >= N_ROMS)
+	return 0xAAAAAAAAAAAAAAAAULL;
+
+    r = & (roms [rom]);
+    for (j = 7; j >= 0; j--) {
+	uint64_t addr = offset + j;
+	uint8_t  b    = 0xAA;
+
+	if ((addr >= r->offset) && (addr - r->offset < r->size))
+	    b = r->bytes [addr - r->offset];
+	x = (x << 8) | b;
+    }
+    return x;
+}
+
+// ****************************************************************
+// ****************************************************************
+// ****************************************************************
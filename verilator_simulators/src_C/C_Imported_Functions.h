@@ -39,6 +39,31 @@ uint8_t c_trygetchar (uint8_t  dummy);
 extern
 uint32_t c_putchar (uint8_t ch);
 
+// ================================================================
+// sim_io_activity
+// Incremented on every console character in or out and on every debug
+// request or response, i.e. on any traffic between the simulated SoC and
+// the host.  Used by the WFI fast-forward (sim_fast_forward.cpp) to tell
+// an idle SoC from one that is talking to the outside world.
+
+extern
+uint64_t sim_io_activity;
+
+// ================================================================
+// c_set_instret ()
+// Called at the end of simulation (Verilog_RTL/sim_instret.vh) with the
+// core's minstret, for processors whose Include.mk names it (INSTRET_REG).
+// sim_main.cpp prints it after the cycle count.
+
+extern
+void c_set_instret (uint64_t instret);
+
+extern
+uint64_t sim_instret;
+
+extern
+int sim_instret_valid;
+
 // ****************************************************************
 // ****************************************************************
 // ****************************************************************
@@ -129,6 +154,29 @@ uint8_t c_debug_client_response_send (const uint32_t data);
 // ****************************************************************
 // ****************************************************************
 
+// Functions for boot ROM and flash contents (Verilog_RTL/DPI_ROM/)
+
+// ================================================================
+// c_rom_load ()
+// Loads the binary file 'filename' as the contents of ROM 'rom' (0 = boot
+// ROM, 1 = flash), its first byte at byte 'offset' in the device.
+// Returns 1 if ok, 0 (after printing the reason) if not.
+
+extern
+uint32_t c_rom_load (uint32_t rom, const char *filename, uint64_t offset);
+
+// ================================================================
+// c_rom_read ()
+// Returns the little-endian 64-bit word at byte 'offset' (8-byte aligned)
+// in ROM 'rom'.  Bytes outside the loaded file read as 0xAA.
+
+extern
+uint64_t c_rom_read (uint32_t rom, uint64_t offset);
+
+// ****************************************************************
+// ****************************************************************
+// ****************************************************************
+
 #ifdef __cplusplus
 }
 #endif
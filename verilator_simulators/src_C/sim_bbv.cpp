@@ -0,0 +1,484 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// Basic-block vectors (see sim_bbv.h)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <verilated.h>
+
+#include "sim_bbv.h"
+
+// ================================================================
+// Trace encoding (trace-protocol.pdf).  The lengths of some items depend
+// on the processor: TV_XLEN, TV_FLEN (0 if no FPU) and TV_MLEN (memory
+// address width) are set by the Makefile from procs/<proc>/Include.mk.
+
+#ifndef TV_XLEN
+#define TV_XLEN  64
+#endif
+#ifndef TV_FLEN
+#define TV_FLEN  64
+#endif
+#ifndef TV_MLEN
+#define TV_MLEN  64
+#endif
+
+#define XLEN_BYTES  (TV_XLEN / 8)
+#define FLEN_BYTES  (TV_FLEN / 8)
+#define MLEN_BYTES  ((TV_MLEN + 7) / 8)
+
+// Opcodes
+#define TE_OP_BEGIN_GROUP    1
+#define TE_OP_END_GROUP      2
+#define TE_OP_INCR_PC        3
+#define TE_OP_FULL_REG       4
+#define TE_OP_INCR_REG       5
+#define TE_OP_INCR_REG_OR    6
+#define TE_OP_ADDL_STATE     7
+#define TE_OP_MEM_REQ        8
+#define TE_OP_MEM_RSP        9
+#define TE_OP_HART_RESET    10
+#define TE_OP_STATE_INIT    11
+#define TE_OP_16b_INSTR     16
+#define TE_OP_32b_INSTR     17
+
+// Additional-state identifiers (opcode 7)
+#define TE_ADDL_STATE_PRIV       1
+#define TE_ADDL_STATE_PADDR      2
+#define TE_ADDL_STATE_EADDR      3
+#define TE_ADDL_STATE_DATA8      4
+#define TE_ADDL_STATE_DATA16     5
+#define TE_ADDL_STATE_DATA32     6
+#define TE_ADDL_STATE_DATA64     7
+#define TE_ADDL_STATE_MTIME      8
+#define TE_ADDL_STATE_PC_PADDR   9
+#define TE_ADDL_STATE_PC        10
+
+// Memory request ops (opcode 8) that matter for item lengths: loads, lr
+// and fetches carry no data in the request; stores and sc none in the
+// response
+#define TE_MEM_LOAD    0
+#define TE_MEM_STORE   1
+#define TE_MEM_LR      2
+#define TE_MEM_SC      3
+#define TE_MEM_FETCH  13
+
+// Register addresses (opcode 4) of the FPRs; all others are XLEN wide
+#define TE_REG_FPR_FIRST  0x1020
+#define TE_REG_FPR_LAST   0x103f
+
+// Largest message from the SoC (vec_bytes in Verilog_RTL/sim_bbv.vh)
+#define TV_MSG_BYTES  72
+
+// Key of the block of instructions retired before the first known PC
+#define PC_UNKNOWN  (~ ((uint64_t) 0))
+
+// ================================================================
+
+extern vluint64_t n_cycles;    // sim_main.cpp
+
+static bool      bbv_enabled  = false;
+static uint64_t  bbv_interval = 1000000;
+static char      bbv_prefix [1024];
+
+static FILE     *f_bb        = NULL;
+static FILE     *f_intervals = NULL;
+
+// Decoder: bytes of an item not yet complete, and the op of the last
+// memory request (which sets the length of its response)
+static std::vector <uint8_t>  pending;
+static unsigned               last_req_op = TE_MEM_LOAD;
+
+// The group being decoded
+static bool      in_group    = false;
+static unsigned  g_instr_len = 0;
+static bool      g_incr_pc   = false;
+static bool      g_has_pc    = false;
+static uint64_t  g_new_pc    = 0;
+static bool      g_reset     = false;
+
+// PC of the next instruction, and id of the current basic block (0 until
+// its first instruction)
+static bool      pc_known = false;
+static uint64_t  pc       = 0;
+static uint32_t  cur_bb   = 0;
+
+// Basic-block ids (from 1, in order of first execution), by start PC
+static std::unordered_map <uint64_t, uint32_t>  bb_ids;
+static std::vector <uint64_t>                   bb_pcs;
+
+// The current interval: instructions per basic block
+static std::map <uint32_t, uint64_t>  interval_counts;
+static uint64_t  interval_insns   = 0;
+static uint64_t  interval_first   = 0;
+static uint64_t  interval_cycle   = 0;
+static uint64_t  n_intervals      = 0;
+
+static uint64_t  n_insns    = 0;
+static uint64_t  n_messages = 0;
+static uint64_t  n_errors   = 0;
+
+// ================================================================
+// Help functions
+
+// Returns the value of +<name>=<value>, or NULL if absent
+static const char *plusarg_value (const char *name)
+{
+    char        match [64];
+    const char *arg;
+
+    snprintf (match, sizeof (match), "%s=", name);
+    arg = Verilated::commandArgsPlusMatch (match);
+    if ((arg == NULL) || (arg [0] != '+'))
+	return NULL;
+    return arg + strlen (match) + 1;
+}
+
+static FILE *open_output (const char *suffix)
+{
+    char  name [1100];
+    FILE *fp;
+
+    snprintf (name, sizeof (name), "%s.%s", bbv_prefix, suffix);
+    fp = fopen (name, "w");
+    if (fp == NULL)
+	fprintf (stderr, "ERROR: BBV: could not open %s\n", name);
+    return fp;
+}
+
+static uint64_t get_le (const uint8_t *bytes, unsigned n)
+{
+    uint64_t x = 0;
+
+    while (n-- > 0)
+	x = (x << 8) | bytes [n];
+    return x;
+}
+
+// Length of the data of additional state <id>, or -1 if unknown
+static int addl_state_length (uint8_t id)
+{
+    switch (id) {
+    case TE_ADDL_STATE_PRIV:     return 1;
+    case TE_ADDL_STATE_PADDR:
+    case TE_ADDL_STATE_EADDR:
+    case TE_ADDL_STATE_PC_PADDR: return MLEN_BYTES;
+    case TE_ADDL_STATE_DATA8:    return 1;
+    case TE_ADDL_STATE_DATA16:   return 2;
+    case TE_ADDL_STATE_DATA32:   return 4;
+    case TE_ADDL_STATE_DATA64:   return 8;
+    case TE_ADDL_STATE_MTIME:    return 8;
+    case TE_ADDL_STATE_PC:       return XLEN_BYTES;
+    default:                     return -1;
+    }
+}
+
+// Length of the item at the start of buf [0..n): 0 if more bytes are
+// needed to tell, -1 if buf [0] is not an item
+static int item_length (const uint8_t *buf, size_t n)
+{
+    unsigned addr, op, size;
+    int      len;
+
+    switch (buf [0]) {
+    case TE_OP_BEGIN_GROUP:
+    case TE_OP_END_GROUP:
+    case TE_OP_INCR_PC:
+    case TE_OP_HART_RESET:
+    case TE_OP_STATE_INIT:
+	return 1;
+
+    case TE_OP_FULL_REG:
+	if (n < 3)
+	    return 0;
+	addr = buf [1] | (buf [2] << 8);
+	if ((addr >= TE_REG_FPR_FIRST) && (addr <= TE_REG_FPR_LAST))
+	    return 3 + FLEN_BYTES;
+	return 3 + XLEN_BYTES;
+
+    case TE_OP_INCR_REG:
+    case TE_OP_INCR_REG_OR:
+	return 4;
+
+    case TE_OP_ADDL_STATE:
+	if (n < 2)
+	    return 0;
+	len = addl_state_length (buf [1]);
+	return (len < 0) ? -1 : 2 + len;
+
+    case TE_OP_MEM_REQ:
+	if (n < 2 + MLEN_BYTES)
+	    return 0;
+	op   = buf [1 + MLEN_BYTES] & 0xF;
+	size = buf [1 + MLEN_BYTES] >> 4;
+	if (size > 3)
+	    return -1;
+	if ((op == TE_MEM_LOAD) || (op == TE_MEM_LR) || (op == TE_MEM_FETCH))
+	    return 2 + MLEN_BYTES;
+	return 2 + MLEN_BYTES + (1 << size);
+
+    case TE_OP_MEM_RSP:
+	if (n < 2)
+	    return 0;
+	size = buf [1] & 0xF;
+	if (size > 3)
+	    return -1;
+	if ((last_req_op == TE_MEM_STORE) || (last_req_op == TE_MEM_SC))
+	    return 2;
+	return 2 + (1 << size);
+
+    case TE_OP_16b_INSTR:
+	return 3;
+
+    case TE_OP_32b_INSTR:
+	return 5;
+
+    default:
+	return -1;
+    }
+}
+
+// ================================================================
+// Intervals and basic blocks
+
+static void write_interval (void)
+{
+    std::map <uint32_t, uint64_t>::const_iterator  it;
+
+    if (f_bb != NULL) {
+	fputc ('T', f_bb);
+	for (it = interval_counts.begin (); it != interval_counts.end (); it++)
+	    fprintf (f_bb, ":%u:%llu ", it->first, (unsigned long long) it->second);
+	fputc ('\n', f_bb);
+    }
+    if (f_intervals != NULL)
+	fprintf (f_intervals, "%llu %llu %llu %llu %llu\n",
+		 (unsigned long long) n_intervals,
+		 (unsigned long long) interval_first, (unsigned long long) interval_insns,
+		 (unsigned long long) interval_cycle, (unsigned long long) (n_cycles - interval_cycle));
+
+    n_intervals++;
+    interval_counts.clear ();
+    interval_first = n_insns;
+    interval_insns = 0;
+    interval_cycle = n_cycles;
+}
+
+static uint32_t bb_id (uint64_t start_pc)
+{
+    std::unordered_map <uint64_t, uint32_t>::const_iterator  it = bb_ids.find (start_pc);
+
+    if (it != bb_ids.end ())
+	return it->second;
+    bb_pcs.push_back (start_pc);
+    bb_ids [start_pc] = bb_pcs.size ();
+    return bb_pcs.size ();
+}
+
+// A group ends at an end-group item, or at the next begin-group.  Its
+// instruction (if any) is at the PC left by the previous group.  The next
+// PC is given either as an increment or in full; encoders may report it in
+// full even after a sequential instruction, so only a PC other than the
+// fall-through one (jump, taken branch, trap), or one given by a group
+// without an instruction (interrupt), ends the basic block.
+static void end_group (void)
+{
+    uint64_t  next_pc;
+
+    if (! in_group)
+	return;
+    in_group = false;
+
+    if (g_reset) {
+	pc_known = false;
+	cur_bb   = 0;
+    }
+
+    if (g_instr_len != 0) {
+	if (cur_bb == 0)
+	    cur_bb = bb_id (pc_known ? pc : PC_UNKNOWN);
+	interval_counts [cur_bb]++;
+	interval_insns++;
+	n_insns++;
+
+	next_pc = pc + g_instr_len;
+	if (g_has_pc) {
+	    if ((! pc_known) || (g_new_pc != next_pc))
+		cur_bb = 0;
+	    pc       = g_new_pc;
+	    pc_known = true;
+	}
+	else if (g_incr_pc && pc_known)
+	    pc = next_pc;
+    }
+    else if (g_has_pc) {
+	pc       = g_new_pc;
+	pc_known = true;
+	cur_bb   = 0;
+    }
+
+    g_instr_len = 0;
+    g_incr_pc   = false;
+    g_has_pc    = false;
+    g_reset     = false;
+
+    if (interval_insns == bbv_interval)
+	write_interval ();
+}
+
+static void decode_item (const uint8_t *item)
+{
+    switch (item [0]) {
+    case TE_OP_BEGIN_GROUP:
+	end_group ();
+	in_group = true;
+	break;
+
+    case TE_OP_END_GROUP:
+	end_group ();
+	break;
+
+    case TE_OP_INCR_PC:
+	g_incr_pc = true;
+	break;
+
+    case TE_OP_ADDL_STATE:
+	if (item [1] == TE_ADDL_STATE_PC) {
+	    g_new_pc = get_le (item + 2, XLEN_BYTES);
+	    g_has_pc = true;
+	}
+	break;
+
+    case TE_OP_MEM_REQ:
+	last_req_op = item [1 + MLEN_BYTES] & 0xF;
+	break;
+
+    case TE_OP_HART_RESET:
+	g_reset = true;
+	break;
+
+    case TE_OP_16b_INSTR:
+	g_instr_len = 2;
+	break;
+
+    case TE_OP_32b_INSTR:
+	g_instr_len = 4;
+	break;
+    }
+}
+
+// ================================================================
+
+void bbv_init (void)
+{
+    const char *flag = Verilated::commandArgsPlusMatch ("bbv");
+    const char *value;
+
+    if ((flag == NULL) || (strcmp (flag, "+bbv") != 0))
+	return;
+
+    value = plusarg_value ("bbv_interval");
+    if (value != NULL)
+	bbv_interval = strtoull (value, NULL, 0);
+    if (bbv_interval == 0)
+	bbv_interval = 1;
+    value = plusarg_value ("bbv_out");
+    snprintf (bbv_prefix, sizeof (bbv_prefix), "%s", (value != NULL) ? value : "bbv");
+
+    f_bb        = open_output ("bb");
+    f_intervals = open_output ("intervals");
+    if ((f_bb == NULL) || (f_intervals == NULL)) {
+	fprintf (stderr, "WARNING: BBV collection disabled\n");
+	return;
+    }
+    fprintf (f_intervals, "# interval first_insn insns first_cycle cycles\n");
+
+    bbv_enabled = true;
+    VL_PRINTF ("INFO: BBV collection enabled (interval %llu instructions, output %s.*)\n",
+	       (unsigned long long) bbv_interval, bbv_prefix);
+}
+
+// ================================================================
+
+void c_tv_bbv_put (uint32_t num_bytes, const svBitVecVal *vec_bytes)
+{
+    size_t  pos, n;
+    int     len;
+    uint32_t j;
+
+    if (! bbv_enabled)
+	return;
+
+    n_messages++;
+    if (num_bytes > TV_MSG_BYTES)
+	num_bytes = TV_MSG_BYTES;
+    for (j = 0; j < num_bytes; j++)
+	pending.push_back ((uint8_t) (vec_bytes [j / 4] >> (8 * (j % 4))));
+
+    pos = 0;
+    n   = pending.size ();
+    while (pos < n) {
+	len = item_length (& pending [pos], n - pos);
+	if (len < 0) {
+	    // Not a known item: drop the rest of the message and the group
+	    // it belongs to, and start again at the next message
+	    n_errors++;
+	    in_group    = false;
+	    g_instr_len = 0;
+	    g_incr_pc   = false;
+	    g_has_pc    = false;
+	    g_reset     = false;
+	    pending.clear ();
+	    return;
+	}
+	if ((len == 0) || (pos + len > n))
+	    break;
+	decode_item (& pending [pos]);
+	pos += len;
+    }
+    pending.erase (pending.begin (), pending.begin () + pos);
+}
+
+// ================================================================
+
+void bbv_final (void)
+{
+    FILE   *f_map;
+    size_t  j;
+
+    if (! bbv_enabled)
+	return;
+
+    end_group ();
+    if (interval_insns != 0)
+	write_interval ();
+    fclose (f_bb);
+    fclose (f_intervals);
+
+    f_map = open_output ("bbmap");
+    if (f_map != NULL) {
+	fprintf (f_map, "# id start_pc\n");
+	for (j = 0; j < bb_pcs.size (); j++) {
+	    if (bb_pcs [j] == PC_UNKNOWN)
+		fprintf (f_map, "%zu unknown\n", j + 1);
+	    else
+		fprintf (f_map, "%zu 0x%llx\n", j + 1, (unsigned long long) bb_pcs [j]);
+	}
+	fclose (f_map);
+    }
+
+    VL_PRINTF ("BBV: %llu instructions in %llu intervals, %zu basic blocks (%llu trace messages, %llu decoding errors)\n",
+	       (unsigned long long) n_insns, (unsigned long long) n_intervals, bb_pcs.size (),
+	       (unsigned long long) n_messages, (unsigned long long) n_errors);
+    if (n_messages == 0)
+	fprintf (stderr, "WARNING: BBV: no trace messages: the processor does not drive its tandem-verification port\n");
+}
+
+// ================================================================
@@ -0,0 +1,50 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+#pragma once
+
+// ================================================================
+// Basic-block vectors, for sampled (SimPoint-style) simulation.
+//
+// The core reports each retired instruction, trap and interrupt on its
+// tandem-verification (TV) port, in the trace format of trace-protocol.pdf
+// (at the top of the repository).  With "make simulator BBV=1", the
+// messages that mkTop_HW_Side drains from the SoC are also passed to
+// c_tv_bbv_put () (Verilog_RTL/sim_bbv.vh), which decodes them and follows
+// the PC, given by each group as an increment or in full: a basic block
+// starts at the target of each jump, taken branch, trap or interrupt (a
+// new PC other than the fall-through one, or one given without an
+// instruction).  The decoder is tested on both encodings by
+// "make bbv_tests" (bbv_tests/).  Every
+// bbv_interval retired instructions, the number of instructions executed
+// in each basic block is written out, as one line of a SimPoint ".bb" file.
+//
+// Enabled at run time by +bbv; other plusargs:
+//     +bbv_interval=<n>    instructions per interval (default 1000000)
+//     +bbv_out=<prefix>    output files (default "bbv"):
+//         <prefix>.bb         one "T:<id>:<count> ..." line per interval
+//         <prefix>.intervals  first instruction and cycle, and length in
+//                             instructions and cycles, of each interval
+//         <prefix>.bbmap      start PC of each basic-block id
+// run/SimPoint.py clusters the intervals and picks one to simulate in
+// detail per cluster (see "make bbv" in run/Makefile).
+//
+// A processor whose RTL does not drive the TV port produces no messages;
+// bbv_final () then warns that nothing was collected.
+// ================================================================
+
+#include <stdint.h>
+#include <svdpi.h>
+
+// Reads the plusargs and opens the output files; call once, after
+// constructing the model
+extern void bbv_init (void);
+
+// Writes the last (partial) interval and the block map, and prints a
+// summary
+extern void bbv_final (void);
+
+// Imported by Verilog_RTL/sim_bbv.vh: one TV message, of num_bytes bytes
+// (byte j in bits [8j+7:8j] of vec_bytes)
+extern "C" void c_tv_bbv_put (uint32_t num_bytes, const svBitVecVal *vec_bytes);
+
+// ================================================================
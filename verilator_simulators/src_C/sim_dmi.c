@@ -12,6 +12,8 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 
+#include "C_Imported_Functions.h"
+
 // #define DEBUG
 
 #ifdef DEBUG
@@ -333,7 +335,10 @@ int vpidmi_request(int fd, int * addr, int * data, int * op)
     assert(data != NULL);
     assert(op != NULL);
 
-    return jtag_vpi_request(fd, addr, data, op);
+    int ret = jtag_vpi_request(fd, addr, data, op);
+    if (ret > 0)
+	sim_io_activity++;
+    return ret;
 }
 
 int vpidmi_response(int fd, int data, int response)
@@ -346,6 +351,7 @@ int vpidmi_response(int fd, int data, int response)
     }
 
     busy = false;
+    sim_io_activity++;
 
     DEBUG_PRINTF(__FILE__ ": dmi response data=0x%08x, response=%d)\n", data, response);
 
@@ -0,0 +1,250 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// WFI fast-forward (see sim_fast_forward.h)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <verilated.h>
+#include <verilated_vpi.h>
+
+#include "C_Imported_Functions.h"
+#include "sim_fast_forward.h"
+
+// Per-processor register names and mtime rate (procs/<proc>/fast_forward.h)
+#include "fast_forward.h"
+
+// ================================================================
+// Names, relative to the SoC, of the registers and signals used
+
+#define FF_SOC  "TOP.mkTop_HW_Side.soc_top."
+
+// Must all be 0 for the SoC to be idle: the core's AXI channels (both
+// directions) and the UART's queue of characters for the console.  These
+// are ports of the SoC's own modules, so are common to all processors
+// (see Resources/fast_forward.vlt).
+static const char *idle_signal_names [] = {
+    "core.master0_awvalid", "core.master0_wvalid", "core.master0_bvalid",
+    "core.master0_arvalid", "core.master0_rvalid",
+    "core.master1_awvalid", "core.master1_wvalid", "core.master1_bvalid",
+    "core.master1_arvalid", "core.master1_rvalid",
+    "RDY_get_to_console_get"
+};
+
+#define N_IDLE_SIGNALS  (sizeof (idle_signal_names) / sizeof (idle_signal_names [0]))
+
+// Cycles between checks for idleness, to keep the cost per cycle low
+#define FF_CHECK_INTERVAL  64
+
+// ================================================================
+
+static bool       ff_enabled = false;
+
+static vpiHandle  h_minstret, h_mcycle, h_mtime, h_mtimecmp, h_wfi_state;
+static vpiHandle  h_idle [N_IDLE_SIGNALS];
+
+static uint64_t   ff_quiet  = 1000;
+static uint64_t   ff_max    = 10000000;
+static uint64_t   ff_margin = 4;
+static uint64_t   ff_wfi_paused = FF_WFI_PAUSED;
+
+static uint64_t   next_check    = 0;
+static uint64_t   quiet_since   = 0;
+static uint64_t   last_minstret = 0;
+static uint64_t   last_activity = 0;
+
+static uint64_t   total_skipped = 0;
+static uint64_t   n_skips       = 0;
+static uint64_t   n_not_wfi     = 0;    // quiet periods with the core not in WFI
+
+// ================================================================
+// Help functions
+
+// Returns the value of +<name>=<value>, or NULL if absent
+static const char *plusarg_value (const char *name)
+{
+    char        match [64];
+    const char *arg;
+
+    snprintf (match, sizeof (match), "%s=", name);
+    arg = Verilated::commandArgsPlusMatch (match);
+    if ((arg == NULL) || (arg [0] != '+'))
+	return NULL;
+    return arg + strlen (match) + 1;
+}
+
+static uint64_t plusarg_u64 (const char *name, uint64_t dflt)
+{
+    const char *value = plusarg_value (name);
+
+    return (value != NULL) ? strtoull (value, NULL, 0) : dflt;
+}
+
+static vpiHandle find_signal (const char *plusarg, const char *dflt)
+{
+    const char *name = (plusarg != NULL) ? plusarg_value (plusarg) : NULL;
+    char        full [1024];
+    vpiHandle   h;
+
+    snprintf (full, sizeof (full), "%s%s", FF_SOC, (name != NULL) ? name : dflt);
+    h = vpi_handle_by_name ((PLI_BYTE8 *) full, NULL);
+    if (h == NULL)
+	fprintf (stderr, "WARNING: WFI fast-forward: no signal %s\n", full);
+    return h;
+}
+
+static uint64_t get_u64 (vpiHandle h)
+{
+    s_vpi_value v;
+    uint64_t    x;
+
+    v.format = vpiVectorVal;
+    vpi_get_value (h, & v);
+    x = (uint32_t) v.value.vector [0].aval;
+    if (vpi_get (vpiSize, h) > 32)
+	x |= ((uint64_t) (uint32_t) v.value.vector [1].aval) << 32;
+    return x;
+}
+
+static void put_u64 (vpiHandle h, uint64_t x)
+{
+    s_vpi_vecval vec [2];
+    s_vpi_value  v;
+
+    vec [0].aval = (PLI_INT32) (uint32_t) x;
+    vec [0].bval = 0;
+    vec [1].aval = (PLI_INT32) (uint32_t) (x >> 32);
+    vec [1].bval = 0;
+    v.format       = vpiVectorVal;
+    v.value.vector = vec;
+    vpi_put_value (h, & v, NULL, vpiNoDelay);
+}
+
+static bool soc_idle (void)
+{
+    s_vpi_value v;
+    size_t      j;
+
+    for (j = 0; j < N_IDLE_SIGNALS; j++) {
+	v.format = vpiIntVal;
+	vpi_get_value (h_idle [j], & v);
+	if (v.value.integer != 0)
+	    return false;
+    }
+    return true;
+}
+
+// ================================================================
+
+void ff_init (void)
+{
+    const char *flag = Verilated::commandArgsPlusMatch ("wfi_ff");
+    bool        ok   = true;
+    size_t      j;
+
+    if ((flag == NULL) || (strcmp (flag, "+wfi_ff") != 0))
+	return;
+
+    ff_quiet  = plusarg_u64 ("ff_quiet",  ff_quiet);
+    ff_max    = plusarg_u64 ("ff_max",    ff_max);
+    ff_margin = plusarg_u64 ("ff_margin", ff_margin);
+    ff_wfi_paused = plusarg_u64 ("ff_wfi_paused", ff_wfi_paused);
+    if (ff_quiet < FF_CHECK_INTERVAL)
+	ff_quiet = FF_CHECK_INTERVAL;
+
+    h_minstret = find_signal ("ff_minstret", FF_MINSTRET);
+    h_mcycle   = find_signal ("ff_mcycle",   FF_MCYCLE);
+    h_mtime    = find_signal ("ff_mtime",    FF_MTIME);
+    h_mtimecmp = find_signal ("ff_mtimecmp", FF_MTIMECMP);
+    h_wfi_state = find_signal ("ff_wfi_state", FF_WFI_STATE);
+    ok = ((h_minstret != NULL) && (h_mcycle != NULL) && (h_mtime != NULL) && (h_mtimecmp != NULL)
+	  && (h_wfi_state != NULL));
+
+    for (j = 0; j < N_IDLE_SIGNALS; j++) {
+	h_idle [j] = find_signal (NULL, idle_signal_names [j]);
+	ok = ok && (h_idle [j] != NULL);
+    }
+
+    if (! ok) {
+	fprintf (stderr, "WARNING: WFI fast-forward disabled\n");
+	return;
+    }
+
+    ff_enabled = true;
+    VL_PRINTF ("INFO: WFI fast-forward enabled (quiet %llu cycles, max skip %llu cycles, margin %llu ticks)\n",
+	       (unsigned long long) ff_quiet, (unsigned long long) ff_max, (unsigned long long) ff_margin);
+}
+
+// ================================================================
+
+uint64_t ff_idle_skip (uint64_t n_cycles)
+{
+    uint64_t minstret, mtime, mtimecmp, ticks, cycles;
+
+    if ((! ff_enabled) || (n_cycles < next_check))
+	return 0;
+    next_check = n_cycles + FF_CHECK_INTERVAL;
+
+    // Any instruction retired, console or debug traffic, or AXI
+    // transaction in flight starts the quiet period again
+    minstret = get_u64 (h_minstret);
+    if ((minstret != last_minstret) || (sim_io_activity != last_activity) || (! soc_idle ())) {
+	last_minstret = minstret;
+	last_activity = sim_io_activity;
+	quiet_since   = n_cycles;
+	return 0;
+    }
+    if (n_cycles - quiet_since < ff_quiet)
+	return 0;
+
+    // Quiet is not enough: the core may be spinning on an operation that
+    // does not retire.  Only a core paused in WFI is skipped.
+    if (get_u64 (h_wfi_state) != ff_wfi_paused) {
+	n_not_wfi++;
+	quiet_since = n_cycles;
+	return 0;
+    }
+
+    // Stop a few ticks short of the timer interrupt, so that the core
+    // takes it, and everything after it, cycle by cycle
+    mtime    = get_u64 (h_mtime);
+    mtimecmp = get_u64 (h_mtimecmp);
+    if ((mtimecmp <= mtime) || (mtimecmp - mtime <= ff_margin))
+	return 0;
+    ticks = mtimecmp - mtime - ff_margin;
+    if (ticks > ff_max / FF_CYCLES_PER_TICK)
+	ticks = ff_max / FF_CYCLES_PER_TICK;
+    if (ticks == 0)
+	return 0;
+    cycles = ticks * FF_CYCLES_PER_TICK;
+
+    put_u64 (h_mtime,  mtime + ticks);
+    put_u64 (h_mcycle, get_u64 (h_mcycle) + cycles);
+
+    total_skipped += cycles;
+    n_skips++;
+
+    // The next skip needs a new quiet period
+    quiet_since = n_cycles + cycles;
+    next_check  = quiet_since + FF_CHECK_INTERVAL;
+    return cycles;
+}
+
+// ================================================================
+
+void ff_final (void)
+{
+    if (! ff_enabled)
+	return;
+
+    VL_PRINTF ("Fast-forwarded cycles: %llu in %llu skips\n",
+	       (unsigned long long) total_skipped, (unsigned long long) n_skips);
+    if (n_not_wfi != 0)
+	VL_PRINTF ("INFO: WFI fast-forward: %llu quiet periods with the core not in WFI"
+		   " (state != %llu; see +ff_wfi_paused)\n",
+		   (unsigned long long) n_not_wfi, (unsigned long long) ff_wfi_paused);
+}
+
+// ================================================================
@@ -0,0 +1,52 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+#pragma once
+
+// ================================================================
+// WFI fast-forward.
+//
+// An RTOS idle task or Linux's cpu_idle parks the core in WFI until the
+// next timer interrupt, which can be millions of cycles away.  When the
+// SoC is quiescent (no instruction retired, no AXI traffic to or from the
+// core, nothing waiting for the console and no console or debug traffic,
+// for ff_quiet cycles) and the core's state register says it is paused in
+// WFI (so that a long non-retiring operation is never skipped),
+// ff_idle_skip () advances the CLINT's mtime and the
+// core's mcycle by as many cycles as the core would otherwise have waited:
+// up to a few ticks before mtimecmp, and at most ff_max cycles at a time
+// (so that console input and debugger requests are still seen, and a core
+// waiting for an external interrupt is still skipped in chunks).  The
+// core then wakes up into the same architectural state it would have
+// reached cycle by cycle; only the simulated cycle count (which includes
+// the skipped cycles) and the wall time differ.
+//
+// Built in by "make simulator PROC=<proc> WFI_FF=1", for processors that
+// provide procs/<proc>/fast_forward.{h,vlt} (the names of their minstret,
+// mcycle, mtime, mtimecmp and CPU state registers, the state's value in
+// WFI, and the Verilator directives that make them visible).  Enabled at run time by +wfi_ff; other plusargs:
+//     +ff_quiet=<cycles>    idle cycles required before a skip (default 1000)
+//     +ff_max=<cycles>      longest single skip (default 10000000)
+//     +ff_margin=<ticks>    mtime ticks left before mtimecmp (default 4)
+//     +ff_minstret=<name>, +ff_mcycle=<name>, +ff_mtime=<name>,
+//     +ff_mtimecmp=<name>, +ff_wfi_state=<name>
+//                           override the VPI names in fast_forward.h
+//     +ff_wfi_paused=<n>    override the CPU state value for WFI
+// If any register cannot be found, a warning is printed and the simulator
+// runs cycle by cycle as usual.
+// ================================================================
+
+#include <stdint.h>
+
+// Reads the plusargs and finds the registers; call once, after
+// constructing the model
+extern void ff_init (void);
+
+// Call after each rising clock edge has been evaluated.  Returns the
+// number of cycles skipped (0 if the SoC is not idle); the caller adds
+// them to its own cycle count and simulation time.
+extern uint64_t ff_idle_skip (uint64_t n_cycles);
+
+// Prints the number of cycles skipped
+extern void ff_final (void);
+
+// ================================================================
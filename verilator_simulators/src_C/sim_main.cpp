@@ -5,15 +5,29 @@
 #include <verilated.h>
 
 #include <sys/stat.h>  // for 'mkdir'
+#include <stdlib.h>    // for 'strtoull'
 
 #include "VmkTop_HW_Side.h"
 
+#include "C_Imported_Functions.h"    // for 'sim_instret'
+
+// If built with WFI_FF=1, skip cycles in which the core idles in WFI
+#ifdef WFI_FF
+# include "sim_fast_forward.h"
+#endif
+
+// If built with BBV=1, collect basic-block vectors from the TV trace
+#ifdef BBV
+# include "sim_bbv.h"
+#endif
+
 // If "verilator --trace" is used, include the tracing class
 #if VM_TRACE
 # include <verilated_vcd_c.h>
 #endif
 
 vluint64_t main_time = 0;    // Current simulation time
+vluint64_t n_cycles  = 0;    // Rising clock edges since reset was deasserted
 
 double sc_time_stamp () {    // Called by $time in Verilog
     return main_time;
@@ -44,6 +58,21 @@ int main (int argc, char **argv, char **env) {
     mkTop_HW_Side->RST_N = 1;
     mkTop_HW_Side->CLK = 0;
 
+    // If passed +max_cycles=<n>, stop after n cycles (e.g. to run a fixed
+    // prefix of a Linux boot); by default run until $finish
+    vluint64_t max_cycles = 0;
+    const char* max_arg = Verilated::commandArgsPlusMatch("max_cycles=");
+    if (max_arg && (0 == strncmp(max_arg, "+max_cycles=", 12))) {
+        max_cycles = strtoull(max_arg + 12, NULL, 0);
+    }
+
+#ifdef WFI_FF
+    ff_init ();
+#endif
+#ifdef BBV
+    bbv_init ();
+#endif
+
     while (! Verilated::gotFinish ()) {
 
 	if (main_time == 2) {
@@ -56,6 +85,7 @@ int main (int argc, char **argv, char **env) {
 	// Toggle clock
 	if ((main_time % 10) == 5) {
 	    mkTop_HW_Side->CLK = 1;
+	    if (main_time > 7) n_cycles++;
 	}
 	else if ((main_time % 10) == 0) {
 	    mkTop_HW_Side->CLK = 0;
@@ -67,11 +97,42 @@ int main (int argc, char **argv, char **env) {
 #endif
 
 	mkTop_HW_Side->eval ();
+
+#ifdef WFI_FF
+	// After a rising edge: if the SoC is idle, jump ahead whole cycles
+	// (keeping the clock phase) and let the model see the new values
+	if (((main_time % 10) == 5) && (main_time > 7)) {
+	    vluint64_t skipped = ff_idle_skip (n_cycles);
+	    if (skipped != 0) {
+		n_cycles  += skipped;
+		main_time += 10 * skipped;
+		mkTop_HW_Side->eval ();
+	    }
+	}
+#endif
+
+	if ((max_cycles != 0) && (n_cycles >= max_cycles)) {
+	    VL_PRINTF ("INFO: stopping after %llu cycles (+max_cycles)\n", (unsigned long long) n_cycles);
+	    break;
+	}
+
 	main_time++;
     }
 
     mkTop_HW_Side->final ();    // Done simulating
 
+    // Reported for regression scripts (see run/Run_regression.py)
+    VL_PRINTF ("Simulated cycles: %llu\n", (unsigned long long) n_cycles);
+    if (sim_instret_valid)
+	VL_PRINTF ("Retired instructions: %llu\n", (unsigned long long) sim_instret);
+#ifdef WFI_FF
+    ff_final ();
+#endif
+#ifdef BBV
+    bbv_final ();
+#endif
+    fflush (stdout);
+
     // Close trace if opened
 #if VM_TRACE
     if (tfp) { tfp->close(); }
@@ -0,0 +1,229 @@
+// Copyright (c) 2019 Bluespec, Inc. All Rights Reserved
+
+// ================================================================
+// Sparse storage for Verilog_RTL/Fast/RegFileLoad.v.
+//
+// The memory model's RegFileLoad is 64M entries of 256 bits (2 GiB);
+// as a Verilog array it is allocated, and cleared at construction, in
+// full, although a test touches a few MB of it.  Here the contents are
+// kept in pages of PAGE_ENTRIES entries, allocated when first written
+// (or loaded from the hex file); entries in pages never written read
+// as 0, like the Verilog array under --x-initial fast.
+//
+// Each entry is 'n_words' 64-bit words, least significant first, and is
+// read and written one word at a time by the DPI-C functions below (see
+// Verilog_RTL/sim_regfile.vh).
+// ================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <ctype.h>
+
+#include <unordered_map>
+#include <vector>
+
+// ================================================================
+
+#define PAGE_BITS     12
+#define PAGE_ENTRIES  (1ULL << PAGE_BITS)
+
+typedef struct {
+    uint32_t  n_words;      // 64-bit words per entry
+    uint64_t  lo, hi;       // index range, as in the Verilog array
+
+    std::unordered_map <uint64_t, std::vector <uint64_t> >  pages;
+
+    // The most recently used page, since accesses are mostly sequential
+    uint64_t  last_page_num;
+    uint64_t *last_page;
+} regfile_t;
+
+// Handles are indexes into this vector; handle 0 is never used, so that
+// c_regfile_open () can return 0 for failure
+static std::vector <regfile_t *> regfiles (1, (regfile_t *) NULL);
+
+// ================================================================
+// Help functions
+
+// Returns the page holding 'index', allocating it if 'alloc' (else NULL
+// if absent)
+static uint64_t *find_page (regfile_t *rf, uint64_t index, bool alloc)
+{
+    uint64_t page_num = (index - rf->lo) >> PAGE_BITS;
+
+    if ((rf->last_page != NULL) && (page_num == rf->last_page_num))
+	return rf->last_page;
+
+    auto it = rf->pages.find (page_num);
+    if (it == rf->pages.end ()) {
+	if (! alloc)
+	    return NULL;
+	it = rf->pages.emplace (page_num, std::vector <uint64_t> (PAGE_ENTRIES * rf->n_words, 0)).first;
+    }
+    rf->last_page_num = page_num;
+    rf->last_page     = it->second.data ();
+    return rf->last_page;
+}
+
+static uint64_t *find_entry (regfile_t *rf, uint64_t index, bool alloc)
+{
+    uint64_t *page;
+
+    if ((index < rf->lo) || (index > rf->hi))
+	return NULL;
+    page = find_page (rf, index, alloc);
+    if (page == NULL)
+	return NULL;
+    return page + (((index - rf->lo) & (PAGE_ENTRIES - 1)) * rf->n_words);
+}
+
+// Stores the digits (base 16 or 2) in 'tok' into entry 'index'
+static void store_value (regfile_t *rf, uint64_t index, const char *tok, size_t len, int bits_per_digit)
+{
+    uint64_t *entry = find_entry (rf, index, true);
+    uint32_t  bit   = 0;
+
+    if (entry == NULL)
+	return;
+    memset (entry, 0, rf->n_words * sizeof (uint64_t));
+
+    // Least significant digit last; '_' separators, and x/z (as 0) allowed
+    while ((len > 0) && (bit < rf->n_words * 64)) {
+	char     ch = tok [--len];
+	uint64_t digit;
+
+	if (ch == '_')
+	    continue;
+	if (isdigit (ch))
+	    digit = ch - '0';
+	else if ((ch >= 'a') && (ch <= 'f'))
+	    digit = ch - 'a' + 10;
+	else if ((ch >= 'A') && (ch <= 'F'))
+	    digit = ch - 'A' + 10;
+	else
+	    digit = 0;
+	entry [bit / 64] |= digit << (bit % 64);
+	bit += bits_per_digit;
+    }
+}
+
+// Reads a $readmemh/$readmemb file: whitespace-separated values, '@<hex>'
+// addresses, '//' and '/* */' comments.  Returns the number of entries
+// loaded, or -1 if the file cannot be opened.
+static int64_t load_file (regfile_t *rf, const char *filename, int bits_per_digit)
+{
+    FILE     *fp = fopen (filename, "r");
+    uint64_t  index = rf->lo;
+    int64_t   n = 0;
+    bool      in_comment = false;
+    char      line [4096];
+
+    if (fp == NULL)
+	return -1;
+
+    while (fgets (line, sizeof (line), fp) != NULL) {
+	char *p = line;
+
+	while (*p != 0) {
+	    if (in_comment) {
+		char *end = strstr (p, "*/");
+		if (end == NULL)
+		    break;
+		p = end + 2;
+		in_comment = false;
+		continue;
+	    }
+	    if (isspace (*p)) {
+		p++;
+		continue;
+	    }
+	    if ((p [0] == '/') && (p [1] == '/'))
+		break;
+	    if ((p [0] == '/') && (p [1] == '*')) {
+		p += 2;
+		in_comment = true;
+		continue;
+	    }
+
+	    char *tok = p;
+	    while ((*p != 0) && (! isspace (*p)) && (*p != '/'))
+		p++;
+
+	    if (tok [0] == '@')
+		index = strtoull (tok + 1, NULL, 16);
+	    else {
+		if (index > rf->hi) {
+		    fprintf (stderr, "WARNING: RegFileLoad: %s: data beyond index 0x%" PRIx64 " ignored\n",
+			     filename, rf->hi);
+		    fclose (fp);
+		    return n;
+		}
+		store_value (rf, index, tok, p - tok, bits_per_digit);
+		index++;
+		n++;
+	    }
+	}
+    }
+    fclose (fp);
+    return n;
+}
+
+// ================================================================
+// DPI-C functions
+
+extern "C" {
+
+uint32_t c_regfile_open (const char *filename, uint32_t binary, uint32_t data_width,
+			 uint64_t lo, uint64_t hi)
+{
+    regfile_t *rf = new regfile_t;
+
+    rf->n_words   = (data_width + 63) / 64;
+    rf->lo        = lo;
+    rf->hi        = hi;
+    rf->last_page = NULL;
+
+    if ((filename != NULL) && (filename [0] != 0)) {
+	int64_t n = load_file (rf, filename, binary ? 1 : 4);
+	if (n < 0) {
+	    fprintf (stderr, "ERROR: RegFileLoad: could not open file: %s\n", filename);
+	    delete rf;
+	    return 0;
+	}
+	fprintf (stdout, "INFO: RegFileLoad: loaded %" PRId64 " entries from %s (%zu pages)\n",
+		 n, filename, rf->pages.size ());
+    }
+
+    regfiles.push_back (rf);
+    return regfiles.size () - 1;
+}
+
+uint64_t c_regfile_read (uint32_t handle, uint64_t index, uint32_t word, uint32_t dummy)
+{
+    regfile_t *rf = (handle < regfiles.size ()) ? regfiles [handle] : NULL;
+    uint64_t  *entry;
+
+    if ((rf == NULL) || (word >= rf->n_words))
+	return 0;
+    entry = find_entry (rf, index, false);
+    return (entry != NULL) ? entry [word] : 0;
+}
+
+void c_regfile_write (uint32_t handle, uint64_t index, uint32_t word, uint64_t data)
+{
+    regfile_t *rf = (handle < regfiles.size ()) ? regfiles [handle] : NULL;
+    uint64_t  *entry;
+
+    if ((rf == NULL) || (word >= rf->n_words))
+	return;
+    entry = find_entry (rf, index, true);
+    if (entry != NULL)
+	entry [word] = data;
+}
+
+}
+
+// ================================================================
@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <errno.h>
 #include <poll.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -11,6 +12,8 @@
 #include <netinet/in.h>
 #include <netinet/ip.h>
 
+#include "C_Imported_Functions.h"
+
 //#define DEBUG
 
 #ifdef DEBUG
@@ -106,6 +109,8 @@ int socket_getchar(int fd) {
 	abort();
     }
 
+    if (ret > 0)
+	sim_io_activity++;
     return ret > 0 ? c : -1;
 }
 